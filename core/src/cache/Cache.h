@@ -12,12 +12,15 @@
 #pragma once
 
 #include "LRU.h"
+#include "utils/Json.h"
 #include "utils/Log.h"
 
 #include <atomic>
+#include <functional>
 #include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 
 namespace milvus {
 namespace cache {
@@ -81,6 +84,23 @@ class Cache {
     void
     clear();
 
+    uint64_t
+    hit_count() const;
+
+    uint64_t
+    miss_count() const;
+
+    uint64_t
+    eviction_count() const;
+
+    // total item size of each key group, keys are mapped to groups by group_of, empty group is skipped
+    std::unordered_map<std::string, int64_t>
+    group_size(const std::function<std::string(const std::string&)>& group_of);
+
+    // item size, hit count and last access, most recently used first
+    milvus::json
+    dump(int64_t limit);
+
  private:
     void
     insert_internal(const std::string& key, const ItemObj& item);
@@ -99,6 +119,15 @@ class Cache {
 
     LRU<std::string, ItemObj> lru_;
     mutable std::mutex mutex_;
+
+    struct ItemStat {
+        uint64_t hits = 0;
+        int64_t last_access = 0;  // unit: us since epoch
+    };
+    std::unordered_map<std::string, ItemStat> item_stats_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
 };
 
 }  // namespace cache
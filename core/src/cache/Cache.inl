@@ -9,11 +9,19 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
+#include <chrono>
+
 namespace milvus {
 namespace cache {
 
 constexpr double DEFAULT_THRESHOLD_PERCENT = 0.7;
 
+inline int64_t
+NowInMicroseconds() {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+
 template <typename ItemObj>
 Cache<ItemObj>::Cache(int64_t capacity, int64_t cache_max_count, const std::string& header)
     : header_(header),
@@ -52,8 +60,13 @@ ItemObj
 Cache<ItemObj>::get(const std::string& key) {
     std::lock_guard<std::mutex> lock(mutex_);
     if (!lru_.exists(key)) {
+        ++misses_;
         return nullptr;
     }
+    ++hits_;
+    auto& stat = item_stats_[key];
+    ++stat.hits;
+    stat.last_access = NowInMicroseconds();
     return lru_.get(key);
 }
 
@@ -101,10 +114,74 @@ void
 Cache<ItemObj>::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
     lru_.clear();
+    item_stats_.clear();
     usage_ = 0;
     LOG_SERVER_DEBUG_ << header_ << " Clear cache !";
 }
 
+template <typename ItemObj>
+uint64_t
+Cache<ItemObj>::hit_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+}
+
+template <typename ItemObj>
+uint64_t
+Cache<ItemObj>::miss_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+}
+
+template <typename ItemObj>
+uint64_t
+Cache<ItemObj>::eviction_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return evictions_;
+}
+
+template <typename ItemObj>
+milvus::json
+Cache<ItemObj>::dump(int64_t limit) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    milvus::json items = milvus::json::array();
+    for (auto it = lru_.begin(); it != lru_.end() && (int64_t)items.size() < limit; ++it) {
+        auto& stat = item_stats_[it->first];
+        milvus::json item{
+            {"key", it->first},
+            {"size", it->second->Size()},
+            {"hits", stat.hits},
+            {"last_access", stat.last_access},
+        };
+        items.push_back(item);
+    }
+
+    milvus::json ret{
+        {"item_count", lru_.size()},
+        {"usage", usage_},
+        {"capacity", capacity_},
+        {"hits", hits_},
+        {"misses", misses_},
+        {"evictions", evictions_},
+        {"items", items},
+    };
+    return ret;
+}
+
+
+template <typename ItemObj>
+std::unordered_map<std::string, int64_t>
+Cache<ItemObj>::group_size(const std::function<std::string(const std::string&)>& group_of) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unordered_map<std::string, int64_t> sizes;
+    for (auto it = lru_.begin(); it != lru_.end(); ++it) {
+        auto group = group_of(it->first);
+        if (!group.empty()) {
+            sizes[group] += it->second->Size();
+        }
+    }
+    return sizes;
+}
 
 template <typename ItemObj>
 void
@@ -145,6 +222,7 @@ Cache<ItemObj>::insert_internal(const std::string& key, const ItemObj& item) {
 
     // insert new item
     lru_.put(key, item);
+    item_stats_[key] = ItemStat{0, NowInMicroseconds()};
     LOG_SERVER_DEBUG_ << header_ << " Insert " << key << " size: " << (item_size >> 20) << "MB into cache";
     LOG_SERVER_DEBUG_ << header_ << " Count: " << lru_.size() << ", Usage: " << (usage_ >> 20) << "MB, Capacity: "
                      << (capacity_ >> 20) << "MB";
@@ -161,6 +239,7 @@ Cache<ItemObj>::erase_internal(const std::string& key) {
     size_t item_size = item->Size();
 
     lru_.erase(key);
+    item_stats_.erase(key);
 
     usage_ -= item_size;
     LOG_SERVER_DEBUG_ << header_ << " Erase " << key << " size: " << (item_size >> 20) << "MB from cache";
@@ -192,6 +271,7 @@ Cache<ItemObj>::free_memory_internal(const int64_t target_size) {
 
     LOG_SERVER_DEBUG_ << header_ << " To be released memory size: " << (released_size >> 20) << "MB";
 
+    evictions_ += key_array.size();
     for (auto& key : key_array) {
         erase_internal(key);
     }
@@ -15,8 +15,10 @@
 #include "metrics/Metrics.h"
 #include "utils/Log.h"
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 namespace milvus {
 namespace cache {
@@ -60,6 +62,23 @@ class CacheMgr {
     void
     SetCapacity(int64_t capacity);
 
+    uint64_t
+    HitCount() const;
+
+    uint64_t
+    MissCount() const;
+
+    uint64_t
+    EvictionCount() const;
+
+    // total item size of each key group, see Cache::group_size
+    std::unordered_map<std::string, int64_t>
+    GroupSize(const std::function<std::string(const std::string&)>& group_of);
+
+    // usage, lookup counters and at most limit items, most recently used first
+    milvus::json
+    Dump(int64_t limit);
+
  protected:
     CacheMgr();
 
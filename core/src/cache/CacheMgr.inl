@@ -144,5 +144,55 @@ CacheMgr<ItemObj>::SetCapacity(int64_t capacity) {
     cache_->set_capacity(capacity);
 }
 
+template <typename ItemObj>
+uint64_t
+CacheMgr<ItemObj>::HitCount() const {
+    if (cache_ == nullptr) {
+        LOG_SERVER_ERROR_ << "Cache doesn't exist";
+        return 0;
+    }
+    return cache_->hit_count();
+}
+
+template <typename ItemObj>
+uint64_t
+CacheMgr<ItemObj>::MissCount() const {
+    if (cache_ == nullptr) {
+        LOG_SERVER_ERROR_ << "Cache doesn't exist";
+        return 0;
+    }
+    return cache_->miss_count();
+}
+
+template <typename ItemObj>
+uint64_t
+CacheMgr<ItemObj>::EvictionCount() const {
+    if (cache_ == nullptr) {
+        LOG_SERVER_ERROR_ << "Cache doesn't exist";
+        return 0;
+    }
+    return cache_->eviction_count();
+}
+
+template <typename ItemObj>
+std::unordered_map<std::string, int64_t>
+CacheMgr<ItemObj>::GroupSize(const std::function<std::string(const std::string&)>& group_of) {
+    if (cache_ == nullptr) {
+        LOG_SERVER_ERROR_ << "Cache doesn't exist";
+        return {};
+    }
+    return cache_->group_size(group_of);
+}
+
+template <typename ItemObj>
+milvus::json
+CacheMgr<ItemObj>::Dump(int64_t limit) {
+    if (cache_ == nullptr) {
+        LOG_SERVER_ERROR_ << "Cache doesn't exist";
+        return milvus::json();
+    }
+    return cache_->dump(limit);
+}
+
 }  // namespace cache
 }  // namespace milvus
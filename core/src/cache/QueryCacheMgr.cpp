@@ -0,0 +1,55 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "cache/QueryCacheMgr.h"
+
+#include <memory>
+
+#include "config/Config.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace cache {
+
+QueryCacheMgr::QueryCacheMgr() {
+    // All config values have been checked in Config::ValidateConfig()
+    server::Config& config = server::Config::GetInstance();
+
+    int64_t query_cache_size = 0;
+    config.GetCacheConfigQueryCacheSize(query_cache_size);
+    LOG_SERVER_INFO_ << "query cache.size: " << query_cache_size;
+    cache_ = std::make_shared<Cache<DataObjPtr>>(query_cache_size, 1UL << 32, "[CACHE QUERY]");
+    enabled_ = query_cache_size > 0;
+
+    SetIdentity("QueryCacheMgr");
+    AddQueryCacheSizeListener();
+}
+
+QueryCacheMgr*
+QueryCacheMgr::GetInstance() {
+    static QueryCacheMgr s_mgr;
+    return &s_mgr;
+}
+
+void
+QueryCacheMgr::OnQueryCacheSizeChanged(int64_t value) {
+    LOG_SERVER_INFO_ << "query cache.size changed to: " << value;
+    if (value > 0) {
+        SetCapacity(value);
+    } else {
+        // the cache doesn't accept zero capacity, drop cached results instead
+        ClearCache();
+    }
+    enabled_ = value > 0;
+}
+
+}  // namespace cache
+}  // namespace milvus
@@ -0,0 +1,48 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "cache/CacheMgr.h"
+#include "cache/DataObj.h"
+#include "config/handler/CacheConfigHandler.h"
+
+namespace milvus {
+namespace cache {
+
+// Caches search results of repeated query vectors, disabled when cache.query_cache_size is 0
+class QueryCacheMgr : public CacheMgr<DataObjPtr>, public server::CacheConfigHandler {
+ private:
+    QueryCacheMgr();
+
+ public:
+    static QueryCacheMgr*
+    GetInstance();
+
+    bool
+    Enabled() const {
+        return enabled_;
+    }
+
+ protected:
+    void
+    OnQueryCacheSizeChanged(int64_t value) override;
+
+ private:
+    std::atomic<bool> enabled_;
+};
+
+}  // namespace cache
+}  // namespace milvus
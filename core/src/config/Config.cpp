@@ -112,6 +112,8 @@ const char* CONFIG_CACHE_CACHE_INSERT_DATA = "cache_insert_data";
 const char* CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT = "false";
 const char* CONFIG_CACHE_PRELOAD_COLLECTION = "preload_collection";
 const char* CONFIG_CACHE_PRELOAD_COLLECTION_DEFAULT = "";
+const char* CONFIG_CACHE_QUERY_CACHE_SIZE = "query_cache_size";
+const char* CONFIG_CACHE_QUERY_CACHE_SIZE_DEFAULT = "0";
 
 /* metric config */
 const char* CONFIG_METRIC = "metric";
@@ -121,6 +123,8 @@ const char* CONFIG_METRIC_ADDRESS = "address";
 const char* CONFIG_METRIC_ADDRESS_DEFAULT = "127.0.0.1";
 const char* CONFIG_METRIC_PORT = "port";
 const char* CONFIG_METRIC_PORT_DEFAULT = "9091";
+const char* CONFIG_METRIC_COLLECTION_TOP_N = "collection_top_n";
+const char* CONFIG_METRIC_COLLECTION_TOP_N_DEFAULT = "20";
 const char* CONFIG_METRIC_CLUSTER_LABEL = "cluster_label";
 const char* CONFIG_METRIC_CLUSTER_LABEL_DEFAULT = "milvus_cluster";
 const char* CONFIG_METRIC_INSTANCE_LABEL = "instance_label";
@@ -138,6 +142,26 @@ const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ = "search_combine_nq";
 const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ_DEFAULT = "64";
 const char* CONFIG_ENGINE_MAX_PARTITION_NUM = "max_partition_num";
 const char* CONFIG_ENGINE_MAX_PARTITION_NUM_DEFAULT = "4096";
+const char* CONFIG_ENGINE_DQL_EXECUTOR_NUM = "dql_executor_num";
+const char* CONFIG_ENGINE_DQL_EXECUTOR_NUM_DEFAULT = "4";
+const char* CONFIG_ENGINE_DQL_LARGE_EXECUTOR_NUM = "dql_large_executor_num";
+const char* CONFIG_ENGINE_DQL_LARGE_EXECUTOR_NUM_DEFAULT = "1";
+const char* CONFIG_ENGINE_DQL_LARGE_QUERY_THRESHOLD = "dql_large_query_threshold";
+const char* CONFIG_ENGINE_DQL_LARGE_QUERY_THRESHOLD_DEFAULT = "100000";
+const char* CONFIG_ENGINE_DQL_MEMORY_LIMIT = "dql_memory_limit";
+const char* CONFIG_ENGINE_DQL_MEMORY_LIMIT_DEFAULT = "0";
+const char* CONFIG_ENGINE_META_CACHE_ENABLE = "meta_cache_enable";
+const char* CONFIG_ENGINE_META_CACHE_ENABLE_DEFAULT = "true";
+const char* CONFIG_ENGINE_SEARCH_PROFILE_SAMPLE_RATE = "search_profile_sample_rate";
+const char* CONFIG_ENGINE_SEARCH_PROFILE_SAMPLE_RATE_DEFAULT = "0";
+const char* CONFIG_ENGINE_SLOW_QUERY_THRESHOLD = "slow_query_threshold";
+const char* CONFIG_ENGINE_SLOW_QUERY_THRESHOLD_DEFAULT = "0";
+const char* CONFIG_ENGINE_RECALL_SAMPLE_RATIO = "recall_sample_ratio";
+const char* CONFIG_ENGINE_RECALL_SAMPLE_RATIO_DEFAULT = "0";
+const char* CONFIG_ENGINE_AUTO_TUNE_TARGET_RECALL = "auto_tune_target_recall";
+const char* CONFIG_ENGINE_AUTO_TUNE_TARGET_RECALL_DEFAULT = "0";
+const char* CONFIG_ENGINE_AUTO_TUNE_LATENCY_SLO_MS = "auto_tune_latency_slo_ms";
+const char* CONFIG_ENGINE_AUTO_TUNE_LATENCY_SLO_MS_DEFAULT = "0";
 /* fpga resource config */
 const char* CONFIG_FPGA_RESOURCE = "fpga";
 const char* CONFIG_FPGA_RESOURCE_ENABLE = "enable";
@@ -178,6 +202,10 @@ const char* CONFIG_GPU_RESOURCE_BUILD_INDEX_RESOURCES_DEFAULT = "gpu0";
 /* tracing config */
 const char* CONFIG_TRACING = "tracing_config";
 const char* CONFIG_TRACING_JSON_CONFIG_PATH = "json_config_path";
+const char* CONFIG_TRACING_SAMPLE_RATE = "sample_rate";
+const char* CONFIG_TRACING_SAMPLE_RATE_DEFAULT = "1";
+const char* CONFIG_TRACING_EXPORTER_PATH = "exporter_path";
+const char* CONFIG_TRACING_EXPORTER_PATH_DEFAULT = "";
 
 /* wal config */
 const char* CONFIG_WAL = "wal";
@@ -241,6 +269,9 @@ Config::Config() {
     std::string node_cache_insert_data = std::string(CONFIG_CACHE) + "." + CONFIG_CACHE_CACHE_INSERT_DATA;
     config_callback_[node_cache_insert_data] = empty_map;
 
+    std::string node_query_cache_size = std::string(CONFIG_CACHE) + "." + CONFIG_CACHE_QUERY_CACHE_SIZE;
+    config_callback_[node_query_cache_size] = empty_map;
+
     // engine config
     std::string node_blas_threshold = std::string(CONFIG_ENGINE) + "." + CONFIG_ENGINE_USE_BLAS_THRESHOLD;
     config_callback_[node_blas_threshold] = empty_map;
@@ -388,6 +419,9 @@ Config::ValidateConfig() {
     std::string metric_port;
     STATUS_CHECK(GetMetricConfigPort(metric_port));
 
+    int64_t metric_collection_top_n;
+    STATUS_CHECK(GetMetricConfigCollectionTopN(metric_collection_top_n));
+
     std::string metric_cluster_label;
     STATUS_CHECK(GetMetricConfigClusterLabel(metric_cluster_label));
 
@@ -410,6 +444,9 @@ Config::ValidateConfig() {
     std::string cache_preload_collection;
     STATUS_CHECK(GetCacheConfigPreloadCollection(cache_preload_collection));
 
+    int64_t cache_query_cache_size;
+    STATUS_CHECK(GetCacheConfigQueryCacheSize(cache_query_cache_size));
+
     /* engine config */
     int64_t engine_use_blas_threshold;
     STATUS_CHECK(GetEngineConfigUseBlasThreshold(engine_use_blas_threshold));
@@ -423,6 +460,36 @@ Config::ValidateConfig() {
     int64_t max_partition_num;
     STATUS_CHECK(GetEngineConfigMaxPartitionNum(max_partition_num));
 
+    int64_t engine_dql_executor_num;
+    STATUS_CHECK(GetEngineConfigDqlExecutorNum(engine_dql_executor_num));
+
+    int64_t engine_dql_large_executor_num;
+    STATUS_CHECK(GetEngineConfigDqlLargeExecutorNum(engine_dql_large_executor_num));
+
+    int64_t engine_dql_large_query_threshold;
+    STATUS_CHECK(GetEngineConfigDqlLargeQueryThreshold(engine_dql_large_query_threshold));
+
+    int64_t engine_dql_memory_limit;
+    STATUS_CHECK(GetEngineConfigDqlMemoryLimit(engine_dql_memory_limit));
+
+    bool engine_meta_cache_enable;
+    STATUS_CHECK(GetEngineConfigMetaCacheEnable(engine_meta_cache_enable));
+
+    float engine_search_profile_sample_rate;
+    STATUS_CHECK(GetEngineConfigSearchProfileSampleRate(engine_search_profile_sample_rate));
+
+    int64_t engine_slow_query_threshold;
+    STATUS_CHECK(GetEngineConfigSlowQueryThreshold(engine_slow_query_threshold));
+
+    float engine_recall_sample_ratio;
+    STATUS_CHECK(GetEngineConfigRecallSampleRatio(engine_recall_sample_ratio));
+
+    float engine_auto_tune_target_recall;
+    STATUS_CHECK(GetEngineConfigAutoTuneTargetRecall(engine_auto_tune_target_recall));
+
+    int64_t engine_auto_tune_latency_slo_ms;
+    STATUS_CHECK(GetEngineConfigAutoTuneLatencySloMs(engine_auto_tune_latency_slo_ms));
+
     /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
     bool gpu_resource_enable;
@@ -454,6 +521,12 @@ Config::ValidateConfig() {
     std::string tracing_config_path;
     STATUS_CHECK(GetTracingConfigJsonConfigPath(tracing_config_path));
 
+    float tracing_sample_rate;
+    STATUS_CHECK(GetTracingConfigSampleRate(tracing_sample_rate));
+
+    std::string tracing_exporter_path;
+    STATUS_CHECK(GetTracingConfigExporterPath(tracing_exporter_path));
+
     /* wal config */
     bool enable;
     STATUS_CHECK(GetWalConfigEnable(enable));
@@ -532,6 +605,7 @@ Config::ResetDefaultConfig() {
     STATUS_CHECK(SetMetricConfigEnableMonitor(CONFIG_METRIC_ENABLE_MONITOR_DEFAULT));
     STATUS_CHECK(SetMetricConfigAddress(CONFIG_METRIC_ADDRESS_DEFAULT));
     STATUS_CHECK(SetMetricConfigPort(CONFIG_METRIC_PORT_DEFAULT));
+    STATUS_CHECK(SetMetricConfigCollectionTopN(CONFIG_METRIC_COLLECTION_TOP_N_DEFAULT));
 
     /* cache config */
     STATUS_CHECK(SetCacheConfigCpuCacheCapacity(CONFIG_CACHE_CPU_CACHE_CAPACITY_DEFAULT));
@@ -539,6 +613,7 @@ Config::ResetDefaultConfig() {
     STATUS_CHECK(SetCacheConfigInsertBufferSize(CONFIG_CACHE_INSERT_BUFFER_SIZE_DEFAULT));
     STATUS_CHECK(SetCacheConfigCacheInsertData(CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT));
     STATUS_CHECK(SetCacheConfigPreloadCollection(CONFIG_CACHE_PRELOAD_COLLECTION_DEFAULT));
+    STATUS_CHECK(SetCacheConfigQueryCacheSize(CONFIG_CACHE_QUERY_CACHE_SIZE_DEFAULT));
 
     /* engine config */
     STATUS_CHECK(SetEngineConfigUseBlasThreshold(CONFIG_ENGINE_USE_BLAS_THRESHOLD_DEFAULT));
@@ -546,6 +621,16 @@ Config::ResetDefaultConfig() {
     STATUS_CHECK(SetEngineConfigSimdType(CONFIG_ENGINE_SIMD_TYPE_DEFAULT));
     STATUS_CHECK(SetEngineSearchCombineMaxNq(CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ_DEFAULT));
     STATUS_CHECK(SetEngineConfigMaxPartitionNum(CONFIG_ENGINE_MAX_PARTITION_NUM_DEFAULT));
+    STATUS_CHECK(SetEngineConfigDqlExecutorNum(CONFIG_ENGINE_DQL_EXECUTOR_NUM_DEFAULT));
+    STATUS_CHECK(SetEngineConfigDqlLargeExecutorNum(CONFIG_ENGINE_DQL_LARGE_EXECUTOR_NUM_DEFAULT));
+    STATUS_CHECK(SetEngineConfigDqlLargeQueryThreshold(CONFIG_ENGINE_DQL_LARGE_QUERY_THRESHOLD_DEFAULT));
+    STATUS_CHECK(SetEngineConfigDqlMemoryLimit(CONFIG_ENGINE_DQL_MEMORY_LIMIT_DEFAULT));
+    STATUS_CHECK(SetEngineConfigMetaCacheEnable(CONFIG_ENGINE_META_CACHE_ENABLE_DEFAULT));
+    STATUS_CHECK(SetEngineConfigSearchProfileSampleRate(CONFIG_ENGINE_SEARCH_PROFILE_SAMPLE_RATE_DEFAULT));
+    STATUS_CHECK(SetEngineConfigSlowQueryThreshold(CONFIG_ENGINE_SLOW_QUERY_THRESHOLD_DEFAULT));
+    STATUS_CHECK(SetEngineConfigRecallSampleRatio(CONFIG_ENGINE_RECALL_SAMPLE_RATIO_DEFAULT));
+    STATUS_CHECK(SetEngineConfigAutoTuneTargetRecall(CONFIG_ENGINE_AUTO_TUNE_TARGET_RECALL_DEFAULT));
+    STATUS_CHECK(SetEngineConfigAutoTuneLatencySloMs(CONFIG_ENGINE_AUTO_TUNE_LATENCY_SLO_MS_DEFAULT));
 
     /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
@@ -661,6 +746,8 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetMetricConfigAddress(value);
         } else if (child_key == CONFIG_METRIC_PORT) {
             status = SetMetricConfigPort(value);
+        } else if (child_key == CONFIG_METRIC_COLLECTION_TOP_N) {
+            status = SetMetricConfigCollectionTopN(value);
         } else {
             status = Status(SERVER_UNEXPECTED_ERROR, invalid_node_str);
         }
@@ -675,6 +762,8 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetCacheConfigInsertBufferSize(value);
         } else if (child_key == CONFIG_CACHE_PRELOAD_COLLECTION) {
             status = SetCacheConfigPreloadCollection(value);
+        } else if (child_key == CONFIG_CACHE_QUERY_CACHE_SIZE) {
+            status = SetCacheConfigQueryCacheSize(value);
         } else {
             status = Status(SERVER_UNEXPECTED_ERROR, invalid_node_str);
         }
@@ -689,6 +778,26 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetEngineSearchCombineMaxNq(value);
         } else if (child_key == CONFIG_ENGINE_MAX_PARTITION_NUM) {
             status = SetEngineConfigMaxPartitionNum(value);
+        } else if (child_key == CONFIG_ENGINE_DQL_EXECUTOR_NUM) {
+            status = SetEngineConfigDqlExecutorNum(value);
+        } else if (child_key == CONFIG_ENGINE_DQL_LARGE_EXECUTOR_NUM) {
+            status = SetEngineConfigDqlLargeExecutorNum(value);
+        } else if (child_key == CONFIG_ENGINE_DQL_LARGE_QUERY_THRESHOLD) {
+            status = SetEngineConfigDqlLargeQueryThreshold(value);
+        } else if (child_key == CONFIG_ENGINE_DQL_MEMORY_LIMIT) {
+            status = SetEngineConfigDqlMemoryLimit(value);
+        } else if (child_key == CONFIG_ENGINE_META_CACHE_ENABLE) {
+            status = SetEngineConfigMetaCacheEnable(value);
+        } else if (child_key == CONFIG_ENGINE_SEARCH_PROFILE_SAMPLE_RATE) {
+            status = SetEngineConfigSearchProfileSampleRate(value);
+        } else if (child_key == CONFIG_ENGINE_SLOW_QUERY_THRESHOLD) {
+            status = SetEngineConfigSlowQueryThreshold(value);
+        } else if (child_key == CONFIG_ENGINE_RECALL_SAMPLE_RATIO) {
+            status = SetEngineConfigRecallSampleRatio(value);
+        } else if (child_key == CONFIG_ENGINE_AUTO_TUNE_TARGET_RECALL) {
+            status = SetEngineConfigAutoTuneTargetRecall(value);
+        } else if (child_key == CONFIG_ENGINE_AUTO_TUNE_LATENCY_SLO_MS) {
+            status = SetEngineConfigAutoTuneLatencySloMs(value);
         } else {
             status = Status(SERVER_UNEXPECTED_ERROR, invalid_node_str);
         }
@@ -715,6 +824,10 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
     } else if (parent_key == CONFIG_TRACING) {
         if (child_key == CONFIG_TRACING_JSON_CONFIG_PATH) {
             status = SetTracingConfigJsonConfigPath(value);
+        } else if (child_key == CONFIG_TRACING_SAMPLE_RATE) {
+            status = SetTracingConfigSampleRate(value);
+        } else if (child_key == CONFIG_TRACING_EXPORTER_PATH) {
+            status = SetTracingConfigExporterPath(value);
         } else {
             status = Status(SERVER_UNEXPECTED_ERROR, invalid_node_str);
         }
@@ -1393,6 +1506,16 @@ Config::CheckMetricConfigPort(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckMetricConfigCollectionTopN(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid metric collection top n: " + value +
+                          ". Possible reason: metric.collection_top_n is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 #ifdef MILVUS_FPGA_VERSION
 Status
 Config::CheckFpgaResourceConfigEnable(const std::string& value) {
@@ -1618,6 +1741,29 @@ Config::CheckCacheConfigPreloadCollection(const std::string& value) {
 }
 
 /* engine config */
+Status
+Config::CheckCacheConfigQueryCacheSize(const std::string& value) {
+    std::string err;
+    int64_t query_cache_size = parse_bytes(value, err);
+    if (not err.empty()) {
+        return Status(SERVER_INVALID_ARGUMENT, err);
+    }
+    if (query_cache_size < 0) {
+        std::string msg = "Invalid query cache size: " + value +
+                          ". Possible reason: cache.query_cache_size is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t total_mem = 0, free_mem = 0;
+    CommonUtil::GetSystemMemInfo(total_mem, free_mem);
+    if (query_cache_size >= total_mem) {
+        std::string msg = "Invalid query cache size: " + value +
+                          ". Possible reason: cache.query_cache_size exceeds system memory.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckEngineConfigUseBlasThreshold(const std::string& value) {
     fiu_return_on("check_config_use_blas_threshold_fail", Status(SERVER_INVALID_ARGUMENT, ""));
@@ -1684,6 +1830,137 @@ Config::CheckEngineConfigMaxPartitionNum(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckEngineConfigDqlExecutorNum(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid dql executor number: " + value +
+                          ". Possible reason: engine_config.dql_executor_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    if (std::stoll(value) <= 0) {
+        std::string msg = "Invalid dql executor number: " + value +
+                          ". Possible reason: engine_config.dql_executor_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigDqlLargeExecutorNum(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid dql large executor number: " + value +
+                          ". Possible reason: engine_config.dql_large_executor_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    if (std::stoll(value) <= 0) {
+        std::string msg = "Invalid dql large executor number: " + value +
+                          ". Possible reason: engine_config.dql_large_executor_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigDqlLargeQueryThreshold(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid dql large query threshold: " + value +
+                          ". Possible reason: engine_config.dql_large_query_threshold is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigDqlMemoryLimit(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid dql memory limit: " + value +
+                          ". Possible reason: engine_config.dql_memory_limit is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigMetaCacheEnable(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid engine config meta_cache_enable: " + value +
+                          ". Possible reason: engine_config.meta_cache_enable is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigSearchProfileSampleRate(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsFloat(value).ok()) {
+        std::string msg = "Invalid engine config search_profile_sample_rate: " + value +
+                          ". Possible reason: engine_config.search_profile_sample_rate is not in range [0.0, 1.0].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        float ratio = std::stof(value);
+        if (ratio < 0.0 || ratio > 1.0) {
+            std::string msg = "Invalid engine config search_profile_sample_rate: " + value +
+                              ". Possible reason: engine_config.search_profile_sample_rate is not in range [0.0, 1.0].";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigSlowQueryThreshold(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid engine config slow_query_threshold: " + value +
+                          ". Possible reason: engine_config.slow_query_threshold is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigRecallSampleRatio(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsFloat(value).ok()) {
+        std::string msg = "Invalid engine config recall sample ratio: " + value +
+                          ". Possible reason: engine_config.recall_sample_ratio is not in range [0.0, 1.0].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        float ratio = std::stof(value);
+        if (ratio < 0.0 || ratio > 1.0) {
+            std::string msg = "Invalid engine config recall sample ratio: " + value +
+                              ". Possible reason: engine_config.recall_sample_ratio is not in range [0.0, 1.0].";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigAutoTuneTargetRecall(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsFloat(value).ok()) {
+        std::string msg = "Invalid auto tune target recall: " + value +
+                          ". Possible reason: engine_config.auto_tune_target_recall is not in range [0.0, 1.0].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        float ratio = std::stof(value);
+        if (ratio < 0.0 || ratio > 1.0) {
+            std::string msg = "Invalid auto tune target recall: " + value +
+                              ". Possible reason: engine_config.auto_tune_target_recall is not in range [0.0, 1.0].";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigAutoTuneLatencySloMs(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid auto tune latency slo: " + value +
+                          ". Possible reason: engine_config.auto_tune_latency_slo_ms is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 #ifdef MILVUS_GPU_VERSION
 
 /* gpu resource config */
@@ -1891,6 +2168,23 @@ Config::CheckTracingConfigJsonConfigPath(const std::string& value) {
     return Status(SERVER_INVALID_ARGUMENT, msg);
 }
 
+Status
+Config::CheckTracingConfigSampleRate(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsFloat(value).ok()) {
+        std::string msg = "Invalid tracing sample rate: " + value +
+                          ". Possible reason: tracing_config.sample_rate is not in range [0.0, 1.0].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        float rate = std::stof(value);
+        if (rate < 0.0 || rate > 1.0) {
+            std::string msg = "Invalid tracing sample rate: " + value +
+                              ". Possible reason: tracing_config.sample_rate is not in range [0.0, 1.0].";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
 /* wal config */
 Status
 Config::CheckWalConfigEnable(const std::string& value) {
@@ -2409,6 +2703,15 @@ Config::GetMetricConfigPort(std::string& value) {
     return CheckMetricConfigPort(value);
 }
 
+Status
+Config::GetMetricConfigCollectionTopN(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_METRIC, CONFIG_METRIC_COLLECTION_TOP_N, CONFIG_METRIC_COLLECTION_TOP_N_DEFAULT);
+    STATUS_CHECK(CheckMetricConfigCollectionTopN(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 Status
 Config::GetMetricConfigClusterLabel(std::string& value) {
     value = GetConfigStr(CONFIG_METRIC, CONFIG_METRIC_CLUSTER_LABEL, CONFIG_METRIC_CLUSTER_LABEL_DEFAULT);
@@ -2470,6 +2773,16 @@ Config::GetCacheConfigPreloadCollection(std::string& value) {
 }
 
 /* engine config */
+Status
+Config::GetCacheConfigQueryCacheSize(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_CACHE, CONFIG_CACHE_QUERY_CACHE_SIZE, CONFIG_CACHE_QUERY_CACHE_SIZE_DEFAULT);
+    STATUS_CHECK(CheckCacheConfigQueryCacheSize(str));
+    std::string err;
+    value = parse_bytes(str, err);
+    return Status::OK();
+}
+
 Status
 Config::GetEngineConfigUseBlasThreshold(int64_t& value) {
     std::string str =
@@ -2511,6 +2824,96 @@ Config::GetEngineConfigMaxPartitionNum(int64_t& value) {
     return Status::OK();
 }
 
+Status
+Config::GetEngineConfigDqlExecutorNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_DQL_EXECUTOR_NUM, CONFIG_ENGINE_DQL_EXECUTOR_NUM_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigDqlExecutorNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigDqlLargeExecutorNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_DQL_LARGE_EXECUTOR_NUM, CONFIG_ENGINE_DQL_LARGE_EXECUTOR_NUM_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigDqlLargeExecutorNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigDqlLargeQueryThreshold(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_DQL_LARGE_QUERY_THRESHOLD,
+                                   CONFIG_ENGINE_DQL_LARGE_QUERY_THRESHOLD_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigDqlLargeQueryThreshold(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigDqlMemoryLimit(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_DQL_MEMORY_LIMIT, CONFIG_ENGINE_DQL_MEMORY_LIMIT_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigDqlMemoryLimit(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigMetaCacheEnable(bool& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_META_CACHE_ENABLE, CONFIG_ENGINE_META_CACHE_ENABLE_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigMetaCacheEnable(str));
+    STATUS_CHECK(StringHelpFunctions::ConvertToBoolean(str, value));
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigSearchProfileSampleRate(float& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_PROFILE_SAMPLE_RATE,
+                                   CONFIG_ENGINE_SEARCH_PROFILE_SAMPLE_RATE_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigSearchProfileSampleRate(str));
+    value = std::stof(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigSlowQueryThreshold(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SLOW_QUERY_THRESHOLD, CONFIG_ENGINE_SLOW_QUERY_THRESHOLD_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigSlowQueryThreshold(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigRecallSampleRatio(float& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_RECALL_SAMPLE_RATIO, CONFIG_ENGINE_RECALL_SAMPLE_RATIO_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigRecallSampleRatio(str));
+    value = std::stof(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigAutoTuneTargetRecall(float& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_AUTO_TUNE_TARGET_RECALL,
+                                   CONFIG_ENGINE_AUTO_TUNE_TARGET_RECALL_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigAutoTuneTargetRecall(str));
+    value = std::stof(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigAutoTuneLatencySloMs(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_AUTO_TUNE_LATENCY_SLO_MS,
+                                   CONFIG_ENGINE_AUTO_TUNE_LATENCY_SLO_MS_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigAutoTuneLatencySloMs(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
 
@@ -2635,6 +3038,20 @@ Config::GetTracingConfigJsonConfigPath(std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::GetTracingConfigSampleRate(float& value) {
+    std::string str = GetConfigStr(CONFIG_TRACING, CONFIG_TRACING_SAMPLE_RATE, CONFIG_TRACING_SAMPLE_RATE_DEFAULT);
+    STATUS_CHECK(CheckTracingConfigSampleRate(str));
+    value = std::stof(str);
+    return Status::OK();
+}
+
+Status
+Config::GetTracingConfigExporterPath(std::string& value) {
+    value = GetConfigStr(CONFIG_TRACING, CONFIG_TRACING_EXPORTER_PATH, CONFIG_TRACING_EXPORTER_PATH_DEFAULT);
+    return Status::OK();
+}
+
 /* wal config */
 Status
 Config::GetWalConfigEnable(bool& wal_enable) {
@@ -2923,6 +3340,12 @@ Config::SetMetricConfigPort(const std::string& value) {
     return SetConfigValueInMem(CONFIG_METRIC, CONFIG_METRIC_PORT, value);
 }
 
+Status
+Config::SetMetricConfigCollectionTopN(const std::string& value) {
+    STATUS_CHECK(CheckMetricConfigCollectionTopN(value));
+    return SetConfigValueInMem(CONFIG_METRIC, CONFIG_METRIC_COLLECTION_TOP_N, value);
+}
+
 /* cache config */
 Status
 Config::SetCacheConfigCpuCacheCapacity(const std::string& value) {
@@ -2959,6 +3382,13 @@ Config::SetCacheConfigPreloadCollection(const std::string& value) {
 }
 
 /* engine config */
+Status
+Config::SetCacheConfigQueryCacheSize(const std::string& value) {
+    STATUS_CHECK(CheckCacheConfigQueryCacheSize(value));
+    STATUS_CHECK(SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_QUERY_CACHE_SIZE, value));
+    return ExecCallBacks(CONFIG_CACHE, CONFIG_CACHE_QUERY_CACHE_SIZE, value);
+}
+
 Status
 Config::SetEngineConfigUseBlasThreshold(const std::string& value) {
     STATUS_CHECK(CheckEngineConfigUseBlasThreshold(value));
@@ -2991,6 +3421,66 @@ Config::SetEngineConfigMaxPartitionNum(const std::string& value) {
     return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_MAX_PARTITION_NUM, value);
 }
 
+Status
+Config::SetEngineConfigDqlExecutorNum(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigDqlExecutorNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_DQL_EXECUTOR_NUM, value);
+}
+
+Status
+Config::SetEngineConfigDqlLargeExecutorNum(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigDqlLargeExecutorNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_DQL_LARGE_EXECUTOR_NUM, value);
+}
+
+Status
+Config::SetEngineConfigDqlLargeQueryThreshold(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigDqlLargeQueryThreshold(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_DQL_LARGE_QUERY_THRESHOLD, value);
+}
+
+Status
+Config::SetEngineConfigDqlMemoryLimit(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigDqlMemoryLimit(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_DQL_MEMORY_LIMIT, value);
+}
+
+Status
+Config::SetEngineConfigMetaCacheEnable(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigMetaCacheEnable(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_META_CACHE_ENABLE, value);
+}
+
+Status
+Config::SetEngineConfigSearchProfileSampleRate(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigSearchProfileSampleRate(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_PROFILE_SAMPLE_RATE, value);
+}
+
+Status
+Config::SetEngineConfigSlowQueryThreshold(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigSlowQueryThreshold(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SLOW_QUERY_THRESHOLD, value);
+}
+
+Status
+Config::SetEngineConfigRecallSampleRatio(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigRecallSampleRatio(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_RECALL_SAMPLE_RATIO, value);
+}
+
+Status
+Config::SetEngineConfigAutoTuneTargetRecall(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigAutoTuneTargetRecall(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_AUTO_TUNE_TARGET_RECALL, value);
+}
+
+Status
+Config::SetEngineConfigAutoTuneLatencySloMs(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigAutoTuneLatencySloMs(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_AUTO_TUNE_LATENCY_SLO_MS, value);
+}
+
 /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
 
@@ -3054,6 +3544,17 @@ Config::SetTracingConfigJsonConfigPath(const std::string& value) {
     return SetConfigValueInMem(CONFIG_TRACING, CONFIG_TRACING_JSON_CONFIG_PATH, value);
 }
 
+Status
+Config::SetTracingConfigSampleRate(const std::string& value) {
+    STATUS_CHECK(CheckTracingConfigSampleRate(value));
+    return SetConfigValueInMem(CONFIG_TRACING, CONFIG_TRACING_SAMPLE_RATE, value);
+}
+
+Status
+Config::SetTracingConfigExporterPath(const std::string& value) {
+    return SetConfigValueInMem(CONFIG_TRACING, CONFIG_TRACING_EXPORTER_PATH, value);
+}
+
 /* wal config */
 Status
 Config::SetWalConfigEnable(const std::string& value) {
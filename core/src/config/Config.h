@@ -84,6 +84,8 @@ extern const char* CONFIG_CACHE_CACHE_INSERT_DATA;
 extern const char* CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT;
 extern const char* CONFIG_CACHE_PRELOAD_COLLECTION;
 extern const char* CONFIG_CACHE_PRELOAD_COLLECTION_DEFAULT;
+extern const char* CONFIG_CACHE_QUERY_CACHE_SIZE;
+extern const char* CONFIG_CACHE_QUERY_CACHE_SIZE_DEFAULT;
 
 /* metric config */
 extern const char* CONFIG_METRIC;
@@ -93,6 +95,8 @@ extern const char* CONFIG_METRIC_ADDRESS;
 extern const char* CONFIG_METRIC_ADDRESS_DEFAULT;
 extern const char* CONFIG_METRIC_PORT;
 extern const char* CONFIG_METRIC_PORT_DEFAULT;
+extern const char* CONFIG_METRIC_COLLECTION_TOP_N;
+extern const char* CONFIG_METRIC_COLLECTION_TOP_N_DEFAULT;
 
 /* engine config */
 extern const char* CONFIG_ENGINE;
@@ -106,6 +110,26 @@ extern const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ;
 extern const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ_DEFAULT;
 extern const char* CONFIG_ENGINE_MAX_PARTITION_NUM;
 extern const char* CONFIG_ENGINE_MAX_PARTITION_NUM_DEFAULT;
+extern const char* CONFIG_ENGINE_DQL_EXECUTOR_NUM;
+extern const char* CONFIG_ENGINE_DQL_EXECUTOR_NUM_DEFAULT;
+extern const char* CONFIG_ENGINE_DQL_LARGE_EXECUTOR_NUM;
+extern const char* CONFIG_ENGINE_DQL_LARGE_EXECUTOR_NUM_DEFAULT;
+extern const char* CONFIG_ENGINE_DQL_LARGE_QUERY_THRESHOLD;
+extern const char* CONFIG_ENGINE_DQL_LARGE_QUERY_THRESHOLD_DEFAULT;
+extern const char* CONFIG_ENGINE_DQL_MEMORY_LIMIT;
+extern const char* CONFIG_ENGINE_DQL_MEMORY_LIMIT_DEFAULT;
+extern const char* CONFIG_ENGINE_META_CACHE_ENABLE;
+extern const char* CONFIG_ENGINE_META_CACHE_ENABLE_DEFAULT;
+extern const char* CONFIG_ENGINE_SEARCH_PROFILE_SAMPLE_RATE;
+extern const char* CONFIG_ENGINE_SEARCH_PROFILE_SAMPLE_RATE_DEFAULT;
+extern const char* CONFIG_ENGINE_SLOW_QUERY_THRESHOLD;
+extern const char* CONFIG_ENGINE_SLOW_QUERY_THRESHOLD_DEFAULT;
+extern const char* CONFIG_ENGINE_RECALL_SAMPLE_RATIO;
+extern const char* CONFIG_ENGINE_RECALL_SAMPLE_RATIO_DEFAULT;
+extern const char* CONFIG_ENGINE_AUTO_TUNE_TARGET_RECALL;
+extern const char* CONFIG_ENGINE_AUTO_TUNE_TARGET_RECALL_DEFAULT;
+extern const char* CONFIG_ENGINE_AUTO_TUNE_LATENCY_SLO_MS;
+extern const char* CONFIG_ENGINE_AUTO_TUNE_LATENCY_SLO_MS_DEFAULT;
 /* fpga resource config*/
 extern const char* CONFIG_FPGA_RESOURCE;
 extern const char* CONFIG_FPGA_RESOURCE_ENABLE;
@@ -140,6 +164,10 @@ extern const char* CONFIG_GPU_RESOURCE_BUILD_INDEX_RESOURCES_DEFAULT;
 /* tracing config */
 extern const char* CONFIG_TRACING;
 extern const char* CONFIG_TRACING_JSON_CONFIG_PATH;
+extern const char* CONFIG_TRACING_SAMPLE_RATE;
+extern const char* CONFIG_TRACING_SAMPLE_RATE_DEFAULT;
+extern const char* CONFIG_TRACING_EXPORTER_PATH;
+extern const char* CONFIG_TRACING_EXPORTER_PATH_DEFAULT;
 
 /* wal config */
 extern const char* CONFIG_WAL;
@@ -281,6 +309,8 @@ class Config {
     CheckMetricConfigAddress(const std::string& value);
     Status
     CheckMetricConfigPort(const std::string& value);
+    Status
+    CheckMetricConfigCollectionTopN(const std::string& value);
 
     /* cache config */
     Status
@@ -293,6 +323,8 @@ class Config {
     CheckCacheConfigCacheInsertData(const std::string& value);
     Status
     CheckCacheConfigPreloadCollection(const std::string& value);
+    Status
+    CheckCacheConfigQueryCacheSize(const std::string& value);
 
     /* engine config */
     Status
@@ -305,6 +337,26 @@ class Config {
     CheckEngineSearchCombineMaxNq(const std::string& value);
     Status
     CheckEngineConfigMaxPartitionNum(const std::string& value);
+    Status
+    CheckEngineConfigDqlExecutorNum(const std::string& value);
+    Status
+    CheckEngineConfigDqlLargeExecutorNum(const std::string& value);
+    Status
+    CheckEngineConfigDqlLargeQueryThreshold(const std::string& value);
+    Status
+    CheckEngineConfigDqlMemoryLimit(const std::string& value);
+    Status
+    CheckEngineConfigMetaCacheEnable(const std::string& value);
+    Status
+    CheckEngineConfigSearchProfileSampleRate(const std::string& value);
+    Status
+    CheckEngineConfigSlowQueryThreshold(const std::string& value);
+    Status
+    CheckEngineConfigRecallSampleRatio(const std::string& value);
+    Status
+    CheckEngineConfigAutoTuneTargetRecall(const std::string& value);
+    Status
+    CheckEngineConfigAutoTuneLatencySloMs(const std::string& value);
 #ifdef MILVUS_FPGA_VERSION
     Status
     GetFpgaResourceConfigCacheThreshold(float& value);
@@ -336,6 +388,8 @@ class Config {
     /* tracing config */
     Status
     CheckTracingConfigJsonConfigPath(const std::string& value);
+    Status
+    CheckTracingConfigSampleRate(const std::string& value);
 
     /* wal config */
     Status
@@ -441,6 +495,8 @@ class Config {
     Status
     GetMetricConfigPort(std::string& value);
     Status
+    GetMetricConfigCollectionTopN(int64_t& value);
+    Status
     GetMetricConfigClusterLabel(std::string& value);
     Status
     GetMetricConfigInstanceLabel(std::string& value);
@@ -456,6 +512,8 @@ class Config {
     GetCacheConfigCacheInsertData(bool& value);
     Status
     GetCacheConfigPreloadCollection(std::string& value);
+    Status
+    GetCacheConfigQueryCacheSize(int64_t& value);
 
     /* engine config */
     Status
@@ -468,6 +526,26 @@ class Config {
     GetEngineSearchCombineMaxNq(int64_t& value);
     Status
     GetEngineConfigMaxPartitionNum(int64_t& value);
+    Status
+    GetEngineConfigDqlExecutorNum(int64_t& value);
+    Status
+    GetEngineConfigDqlLargeExecutorNum(int64_t& value);
+    Status
+    GetEngineConfigDqlLargeQueryThreshold(int64_t& value);
+    Status
+    GetEngineConfigDqlMemoryLimit(int64_t& value);
+    Status
+    GetEngineConfigMetaCacheEnable(bool& value);
+    Status
+    GetEngineConfigSearchProfileSampleRate(float& value);
+    Status
+    GetEngineConfigSlowQueryThreshold(int64_t& value);
+    Status
+    GetEngineConfigRecallSampleRatio(float& value);
+    Status
+    GetEngineConfigAutoTuneTargetRecall(float& value);
+    Status
+    GetEngineConfigAutoTuneLatencySloMs(int64_t& value);
 #ifdef MILVUS_FPGA_VERSION
 
     Status
@@ -496,6 +574,10 @@ class Config {
     /* tracing config */
     Status
     GetTracingConfigJsonConfigPath(std::string& value);
+    Status
+    GetTracingConfigSampleRate(float& value);
+    Status
+    GetTracingConfigExporterPath(std::string& value);
 
     /* wal config */
     Status
@@ -587,6 +669,8 @@ class Config {
     SetMetricConfigAddress(const std::string& value);
     Status
     SetMetricConfigPort(const std::string& value);
+    Status
+    SetMetricConfigCollectionTopN(const std::string& value);
 
     /* cache config */
     Status
@@ -599,6 +683,8 @@ class Config {
     SetCacheConfigCacheInsertData(const std::string& value);
     Status
     SetCacheConfigPreloadCollection(const std::string& value);
+    Status
+    SetCacheConfigQueryCacheSize(const std::string& value);
 
     /* engine config */
     Status
@@ -611,6 +697,26 @@ class Config {
     SetEngineSearchCombineMaxNq(const std::string& value);
     Status
     SetEngineConfigMaxPartitionNum(const std::string& value);
+    Status
+    SetEngineConfigDqlExecutorNum(const std::string& value);
+    Status
+    SetEngineConfigDqlLargeExecutorNum(const std::string& value);
+    Status
+    SetEngineConfigDqlLargeQueryThreshold(const std::string& value);
+    Status
+    SetEngineConfigDqlMemoryLimit(const std::string& value);
+    Status
+    SetEngineConfigMetaCacheEnable(const std::string& value);
+    Status
+    SetEngineConfigSearchProfileSampleRate(const std::string& value);
+    Status
+    SetEngineConfigSlowQueryThreshold(const std::string& value);
+    Status
+    SetEngineConfigRecallSampleRatio(const std::string& value);
+    Status
+    SetEngineConfigAutoTuneTargetRecall(const std::string& value);
+    Status
+    SetEngineConfigAutoTuneLatencySloMs(const std::string& value);
 #ifdef MILVUS_GPU_VERSION
 
     /* gpu resource config */
@@ -633,6 +739,10 @@ class Config {
     /* tracing config */
     Status
     SetTracingConfigJsonConfigPath(const std::string& value);
+    Status
+    SetTracingConfigSampleRate(const std::string& value);
+    Status
+    SetTracingConfigExporterPath(const std::string& value);
 
     /* wal config */
     Status
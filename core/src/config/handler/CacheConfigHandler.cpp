@@ -20,12 +20,14 @@ CacheConfigHandler::CacheConfigHandler() {
     config.GetCacheConfigCpuCacheCapacity(cpu_cache_capacity_);
     config.GetCacheConfigInsertBufferSize(insert_buffer_size_);
     config.GetCacheConfigCacheInsertData(cache_insert_data_);
+    config.GetCacheConfigQueryCacheSize(query_cache_size_);
 }
 
 CacheConfigHandler::~CacheConfigHandler() {
     RemoveCpuCacheCapacityListener();
     RemoveInsertBufferSizeListener();
     RemoveCacheInsertDataListener();
+    RemoveQueryCacheSizeListener();
 }
 
 //////////////////////////// Listener methods //////////////////////////////////
@@ -75,6 +77,21 @@ CacheConfigHandler::AddCacheInsertDataListener() {
     config.RegisterCallBack(CONFIG_CACHE, CONFIG_CACHE_CACHE_INSERT_DATA, identity_, lambda);
 }
 
+void
+CacheConfigHandler::AddQueryCacheSizeListener() {
+    ConfigCallBackF lambda = [this](const std::string& value) -> Status {
+        auto& config = Config::GetInstance();
+        auto status = config.GetCacheConfigQueryCacheSize(query_cache_size_);
+        if (status.ok()) {
+            OnQueryCacheSizeChanged(query_cache_size_);
+        }
+        return status;
+    };
+
+    auto& config = Config::GetInstance();
+    config.RegisterCallBack(CONFIG_CACHE, CONFIG_CACHE_QUERY_CACHE_SIZE, identity_, lambda);
+}
+
 void
 CacheConfigHandler::RemoveCpuCacheCapacityListener() {
     auto& config = Config::GetInstance();
@@ -92,5 +109,11 @@ CacheConfigHandler::RemoveCacheInsertDataListener() {
     auto& config = Config::GetInstance();
     config.CancelCallBack(server::CONFIG_CACHE, server::CONFIG_CACHE_CACHE_INSERT_DATA, identity_);
 }
+
+void
+CacheConfigHandler::RemoveQueryCacheSizeListener() {
+    auto& config = Config::GetInstance();
+    config.CancelCallBack(CONFIG_CACHE, CONFIG_CACHE_QUERY_CACHE_SIZE, identity_);
+}
 }  // namespace server
 }  // namespace milvus
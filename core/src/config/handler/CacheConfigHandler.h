@@ -35,6 +35,10 @@ class CacheConfigHandler : virtual public ConfigHandler {
     OnCacheInsertDataChanged(bool value) {
     }
 
+    virtual void
+    OnQueryCacheSizeChanged(int64_t value) {
+    }
+
  protected:
     void
     AddCpuCacheCapacityListener();
@@ -45,6 +49,9 @@ class CacheConfigHandler : virtual public ConfigHandler {
     void
     AddCacheInsertDataListener();
 
+    void
+    AddQueryCacheSizeListener();
+
     void
     RemoveCpuCacheCapacityListener();
 
@@ -54,10 +61,14 @@ class CacheConfigHandler : virtual public ConfigHandler {
     void
     RemoveCacheInsertDataListener();
 
+    void
+    RemoveQueryCacheSizeListener();
+
  private:
     int64_t cpu_cache_capacity_ = std::stoll(CONFIG_CACHE_CPU_CACHE_CAPACITY_DEFAULT) /*GiB*/;
     int64_t insert_buffer_size_ = std::stoll(CONFIG_CACHE_INSERT_BUFFER_SIZE_DEFAULT) /*GiB*/;
     bool cache_insert_data_ = false;
+    int64_t query_cache_size_ = std::stoll(CONFIG_CACHE_QUERY_CACHE_SIZE_DEFAULT);
 };
 
 }  // namespace server
@@ -138,6 +138,10 @@ class DB {
           const std::vector<std::string>& partition_tags, uint64_t k, const milvus::json& extra_params,
           const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) = 0;
 
+    // queries whose status is not ok are skipped
+    virtual Status
+    QueryMulti(const std::shared_ptr<server::Context>& context, std::vector<CollectionQuery>& queries) = 0;
+
     virtual Status
     QueryByFileID(const std::shared_ptr<server::Context>& context, const std::vector<std::string>& file_ids, uint64_t k,
                   const milvus::json& extra_params, const VectorsData& vectors, ResultIds& result_ids,
@@ -146,6 +150,19 @@ class DB {
     virtual Status
     Size(uint64_t& result) = 0;
 
+    virtual Status
+    GetWalStatus(milvus::json& status) = 0;
+
+    // fill the search param omitted in extra_params with the auto-tuned value of the collection, if any
+    virtual Status
+    FillSearchParams(const std::string& collection_id, int32_t engine_type, int64_t k, milvus::json& extra_params) = 0;
+
+    virtual Status
+    SetSearchTuneTarget(const std::string& collection_id, float target_recall, int64_t latency_slo_ms) = 0;
+
+    virtual Status
+    GetSearchTuneStatus(const std::string& collection_id, milvus::json& status) = 0;
+
     virtual Status
     CreateIndex(const std::shared_ptr<server::Context>& context, const std::string& collection_id,
                 const CollectionIndex& index) = 0;
@@ -31,8 +31,10 @@
 #include "Utils.h"
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
+#include "cache/QueryCacheMgr.h"
 #include "codecs/default/DefaultCodec.h"
 #include "db/IDGenerator.h"
+#include "db/QueryResultCache.h"
 #include "db/merge/MergeManagerFactory.h"
 #include "engine/EngineFactory.h"
 #include "index/knowhere/knowhere/index/vector_index/helpers/BuilderSuspend.h"
@@ -62,6 +64,7 @@ namespace {
 constexpr uint64_t BACKGROUND_METRIC_INTERVAL = 1;
 constexpr uint64_t BACKGROUND_INDEX_INTERVAL = 1;
 constexpr uint64_t WAIT_BUILD_INDEX_INTERVAL = 5;
+constexpr uint64_t ID_PROBE_THREAD_COUNT = 8;
 
 constexpr const char* JSON_ROW_COUNT = "row_count";
 constexpr const char* JSON_PARTITIONS = "partitions";
@@ -73,10 +76,31 @@ constexpr const char* JSON_DATA_SIZE = "data_size";
 
 static const Status SHUTDOWN_ERROR = Status(DB_ERROR, "Milvus server is shutdown!");
 
+void
+AddFilesToSearchJob(const scheduler::SearchJobPtr& job, const meta::SegmentsSchema& files) {
+    for (auto& file : files) {
+        // no need to process shadow files
+        if (file.file_type_ == milvus::engine::meta::SegmentSchema::FILE_TYPE::NEW ||
+            file.file_type_ == milvus::engine::meta::SegmentSchema::FILE_TYPE::NEW_MERGE ||
+            file.file_type_ == milvus::engine::meta::SegmentSchema::FILE_TYPE::NEW_INDEX) {
+            continue;
+        }
+
+        scheduler::SegmentSchemaPtr file_ptr = std::make_shared<meta::SegmentSchema>(file);
+        job->AddIndexFile(file_ptr);
+    }
+}
+
 }  // namespace
 
 DBImpl::DBImpl(const DBOptions& options)
-    : options_(options), initialized_(false), merge_thread_pool_(1, 1), index_thread_pool_(1, 1) {
+    : options_(options),
+      initialized_(false),
+      merge_thread_pool_(1, 1),
+      index_thread_pool_(1, 1),
+      id_probe_thread_pool_(ID_PROBE_THREAD_COUNT),
+      recall_sampler_(options.recall_sample_ratio_),
+      search_tuner_(options.auto_tune_target_recall_, options.auto_tune_latency_slo_ms_) {
     meta_ptr_ = MetaFactory::Build(options.meta_, options.mode_);
     mem_mgr_ = MemManagerFactory::Build(meta_ptr_, options_);
     merge_mgr_ptr_ = MergeManagerFactory::Build(meta_ptr_, options_);
@@ -280,6 +304,12 @@ DBImpl::DropCollection(const std::string& collection_id) {
         return status;
     }
 
+    server::CollectionAccounting::GetInstance().Remove(collection_id);
+    for (auto& partition_id : partition_id_array) {
+        server::CollectionAccounting::GetInstance().Remove(partition_id);
+    }
+    search_tuner_.Remove(collection_id);
+
     return Status::OK();
 }
 
@@ -1384,113 +1414,145 @@ DBImpl::GetVectorsByIdHelper(const IDNumbers& id_array, std::vector<engine::Vect
     }
     vectors.resize(id_array.size());
 
-    for (auto& file : files) {
-        if (temp_ids.empty()) {
-            break;  // all vectors found, no need to continue
-        }
-
-        // SegmentReader
-        std::string segment_dir;
-        engine::utils::GetParentPath(file.location_, segment_dir);
-        segment::SegmentReader segment_reader(segment_dir);
-
-        // uids_ptr
-        segment::UidsPtr uids_ptr = nullptr;
-        auto LoadUid = [&]() {
-            auto index = cache::CpuCacheMgr::GetInstance()->GetItem(file.location_);
-            if (index != nullptr) {
-                uids_ptr = std::static_pointer_cast<knowhere::VecIndex>(index)->GetUids();
-                return Status::OK();
+    // the bloom filters of a batch of files are probed in parallel, the hits are verified in file order
+    // and the remaining batches are skipped once every id is located
+    for (size_t begin = 0; begin < files.size() && !temp_ids.empty(); begin += ID_PROBE_THREAD_COUNT * 2) {
+        size_t end = std::min(files.size(), begin + ID_PROBE_THREAD_COUNT * 2);
+        std::vector<segment::IdBloomFilterPtr> id_bloom_filters(end - begin);
+        std::vector<std::future<Status>> probes;
+        for (size_t j = begin; j < end; ++j) {
+            probes.emplace_back(id_probe_thread_pool_.enqueue(&DBImpl::LoadIdBloomFilter, this, std::cref(files[j]),
+                                                              std::ref(id_bloom_filters[j - begin])));
+        }
+        Status probe_status;
+        for (auto& probe : probes) {
+            auto status = probe.get();
+            if (!status.ok()) {
+                probe_status = status;
             }
+        }
+        if (!probe_status.ok()) {
+            return probe_status;
+        }
 
-            return segment_reader.LoadUids(uids_ptr);
-        };
-
-        // deleted_docs_ptr
-        segment::DeletedDocsPtr deleted_docs_ptr = nullptr;
-        auto LoadDeleteDoc = [&]() { return segment_reader.LoadDeletedDocs(deleted_docs_ptr); };
+        for (size_t j = begin; j < end && !temp_ids.empty(); ++j) {
+            auto& file = files[j];
+            auto& id_bloom_filter_ptr = id_bloom_filters[j - begin];
 
-        // id_bloom_filter_ptr
-        segment::IdBloomFilterPtr id_bloom_filter_ptr;
-        auto status = segment_reader.LoadBloomFilter(id_bloom_filter_ptr, false);
-        fiu_do_on("DBImpl.GetVectorsByIdHelper.FailedToLoadBloomFilter",
-                  (status = Status(DB_ERROR, ""), id_bloom_filter_ptr = nullptr));
-        if (!status.ok()) {
-            // Some accidents may cause the bloom filter file destroyed.
-            // If failed to load bloom filter, just to create a new one.
-            if (!(status = LoadUid()).ok()) {
-                return status;
-            }
-            if (!(status = LoadDeleteDoc()).ok()) {
-                return status;
-            }
+            // SegmentReader
+            std::string segment_dir;
+            engine::utils::GetParentPath(file.location_, segment_dir);
+            segment::SegmentReader segment_reader(segment_dir);
 
-            codec::DefaultCodec default_codec;
-            default_codec.GetIdBloomFilterFormat()->create(uids_ptr->size(), id_bloom_filter_ptr);
-            id_bloom_filter_ptr->Add(*uids_ptr, deleted_docs_ptr->GetMutableDeletedDocs());
-            LOG_ENGINE_DEBUG_ << "A new bloom filter is created";
-
-            segment::SegmentWriter segment_writer(segment_dir);
-            segment_writer.WriteBloomFilter(id_bloom_filter_ptr);
-        }
+            // uids_ptr
+            segment::UidsPtr uids_ptr = nullptr;
+            auto LoadUid = [&]() {
+                auto index = cache::CpuCacheMgr::GetInstance()->GetItem(file.location_);
+                if (index != nullptr) {
+                    uids_ptr = std::static_pointer_cast<knowhere::VecIndex>(index)->GetUids();
+                    return Status::OK();
+                }
 
-        for (size_t i = 0; i < temp_ids.size();) {
-            // each id must has a VectorsData
-            // if vector not found for an id, its VectorsData's vector_count = 0, else 1
-            VectorsData& vector_ref = vectors[temp_ids[i].first];
-            auto vector_id = temp_ids[i].second;
+                return segment_reader.LoadUids(uids_ptr);
+            };
 
-            // Check if the id is present in bloom filter.
-            if (id_bloom_filter_ptr->Check(vector_id)) {
-                // Load uids and check if the id is indeed present. If yes, find its offset.
-                if (uids_ptr == nullptr && !(status = LoadUid()).ok()) {
-                    return status;
-                }
+            // deleted_docs_ptr
+            segment::DeletedDocsPtr deleted_docs_ptr = nullptr;
+            auto LoadDeleteDoc = [&]() { return segment_reader.LoadDeletedDocs(deleted_docs_ptr); };
 
-                auto found = std::find(uids_ptr->begin(), uids_ptr->end(), vector_id);
-                if (found != uids_ptr->end()) {
-                    auto offset = std::distance(uids_ptr->begin(), found);
+            Status status;
+            for (size_t i = 0; i < temp_ids.size();) {
+                // each id must has a VectorsData
+                // if vector not found for an id, its VectorsData's vector_count = 0, else 1
+                VectorsData& vector_ref = vectors[temp_ids[i].first];
+                auto vector_id = temp_ids[i].second;
 
-                    // Check whether the id has been deleted
-                    if (!deleted_docs_ptr && !(status = LoadDeleteDoc()).ok()) {
+                // Check if the id is present in bloom filter.
+                if (id_bloom_filter_ptr->Check(vector_id)) {
+                    // Load uids and check if the id is indeed present. If yes, find its offset.
+                    if (uids_ptr == nullptr && !(status = LoadUid()).ok()) {
                         return status;
                     }
-                    auto& deleted_docs = deleted_docs_ptr->GetDeletedDocs();
-
-                    auto deleted = std::find(deleted_docs.begin(), deleted_docs.end(), offset);
-                    if (deleted == deleted_docs.end()) {
-                        // Load raw vector
-                        std::vector<uint8_t> raw_vector;
-                        status = segment_reader.LoadsSingleVector(offset * single_vector_bytes, single_vector_bytes,
-                                                                  raw_vector);
-                        if (!status.ok()) {
-                            LOG_ENGINE_ERROR_ << status.message();
+
+                    auto found = std::find(uids_ptr->begin(), uids_ptr->end(), vector_id);
+                    if (found != uids_ptr->end()) {
+                        auto offset = std::distance(uids_ptr->begin(), found);
+
+                        // Check whether the id has been deleted
+                        if (!deleted_docs_ptr && !(status = LoadDeleteDoc()).ok()) {
                             return status;
                         }
-
-                        vector_ref.vector_count_ = 1;
-                        if (is_binary) {
-                            vector_ref.binary_data_.swap(raw_vector);
-                        } else {
-                            std::vector<float> float_vector;
-                            float_vector.resize(file.dimension_);
-                            memcpy(float_vector.data(), raw_vector.data(), single_vector_bytes);
-                            vector_ref.float_data_.swap(float_vector);
+                        auto& deleted_docs = deleted_docs_ptr->GetDeletedDocs();
+
+                        auto deleted = std::find(deleted_docs.begin(), deleted_docs.end(), offset);
+                        if (deleted == deleted_docs.end()) {
+                            // Load raw vector
+                            std::vector<uint8_t> raw_vector;
+                            status = segment_reader.LoadsSingleVector(offset * single_vector_bytes,
+                                                                      single_vector_bytes, raw_vector);
+                            if (!status.ok()) {
+                                LOG_ENGINE_ERROR_ << status.message();
+                                return status;
+                            }
+
+                            vector_ref.vector_count_ = 1;
+                            if (is_binary) {
+                                vector_ref.binary_data_.swap(raw_vector);
+                            } else {
+                                std::vector<float> float_vector;
+                                float_vector.resize(file.dimension_);
+                                memcpy(float_vector.data(), raw_vector.data(), single_vector_bytes);
+                                vector_ref.float_data_.swap(float_vector);
+                            }
+                            temp_ids[i] = temp_ids.back();
+                            temp_ids.resize(temp_ids.size() - 1);
+                            continue;
                         }
-                        temp_ids[i] = temp_ids.back();
-                        temp_ids.resize(temp_ids.size() - 1);
-                        continue;
                     }
                 }
+
+                i++;
             }
 
-            i++;
+            // unmark file, allow the file to be deleted
+            files_holder.UnmarkFile(file);
         }
+    }
 
-        // unmark file, allow the file to be deleted
-        files_holder.UnmarkFile(file);
+    return Status::OK();
+}
+
+Status
+DBImpl::LoadIdBloomFilter(const meta::SegmentSchema& file, segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
+    std::string segment_dir;
+    engine::utils::GetParentPath(file.location_, segment_dir);
+    segment::SegmentReader segment_reader(segment_dir);
+
+    auto status = segment_reader.LoadBloomFilter(id_bloom_filter_ptr, false);
+    fiu_do_on("DBImpl.GetVectorsByIdHelper.FailedToLoadBloomFilter",
+              (status = Status(DB_ERROR, ""), id_bloom_filter_ptr = nullptr));
+    if (status.ok()) {
+        return status;
     }
 
+    // Some accidents may cause the bloom filter file destroyed.
+    // If failed to load bloom filter, just to create a new one.
+    segment::UidsPtr uids_ptr = nullptr;
+    if (!(status = segment_reader.LoadUids(uids_ptr)).ok()) {
+        return status;
+    }
+    segment::DeletedDocsPtr deleted_docs_ptr = nullptr;
+    if (!(status = segment_reader.LoadDeletedDocs(deleted_docs_ptr)).ok()) {
+        return status;
+    }
+
+    codec::DefaultCodec default_codec;
+    default_codec.GetIdBloomFilterFormat()->create(uids_ptr->size(), id_bloom_filter_ptr);
+    id_bloom_filter_ptr->Add(*uids_ptr, deleted_docs_ptr->GetMutableDeletedDocs());
+    LOG_ENGINE_DEBUG_ << "A new bloom filter is created";
+
+    segment::SegmentWriter segment_writer(segment_dir);
+    segment_writer.WriteBloomFilter(id_bloom_filter_ptr);
     return Status::OK();
 }
 
@@ -1715,7 +1777,12 @@ DBImpl::Query(const std::shared_ptr<server::Context>& context, const std::string
 
     // step 1: get all collection files from collection
     meta::FilesHolder files_holder;
+    server::ContextStage meta_stage(context, server::SearchStage::META);
+    milvus::server::ContextChild meta_tracer(tracer.Context(), "Meta query");
     Status status = CollectFilesToSearch(collection_id, partition_tags, files_holder);
+    meta_tracer.SetTag("file_count", static_cast<uint64_t>(files_holder.HoldFiles().size()));
+    meta_tracer.Finish();
+    meta_stage.Finish();
     if (!status.ok()) {
         return status;
     }
@@ -1724,14 +1791,139 @@ DBImpl::Query(const std::shared_ptr<server::Context>& context, const std::string
         return Status::OK();  // no files to search
     }
 
-    // step 2: do query
+    // step 2: return cached result of the same query on the same files
+    auto query_cache = cache::QueryCacheMgr::GetInstance();
+    std::string cache_key;
+    if (query_cache->Enabled()) {
+        milvus::server::ContextChild cache_tracer(tracer.Context(), "Query cache lookup");
+        cache_key = QueryCacheKey(collection_id, partition_tags, k, extra_params, vectors, files_holder.HoldFiles());
+        auto obj = std::static_pointer_cast<QueryResultObj>(query_cache->GetItem(cache_key));
+        bool cache_hit = (obj != nullptr && obj->Match(vectors));
+        cache_tracer.SetTag("cache_hit", cache_hit);
+        cache_tracer.Finish();
+        if (cache_hit) {
+            server::Metrics::GetInstance().QueryCacheHitTotalIncrement();
+            result_ids = obj->Ids();
+            result_distances = obj->Distances();
+            return Status::OK();
+        }
+        server::Metrics::GetInstance().QueryCacheMissTotalIncrement();
+    }
+
+    // the files are released by the query, keep a copy for the recall sample
+    meta::SegmentsSchema sampled_files;
+    bool recall_sampled = recall_sampler_.Sample();
+    if (recall_sampled) {
+        sampled_files = files_holder.HoldFiles();
+    }
+
+    search_tuner_.Observe(collection_id, files_holder.HoldFiles(), k, vectors);
+
+    // step 3: do query
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
-    status = QueryAsync(tracer.Context(), files_holder, k, extra_params, vectors, result_ids, result_distances);
+    status = QueryAsync(tracer.Context(), collection_id, files_holder, k, extra_params, vectors, result_ids,
+                        result_distances);
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
 
+    if (status.ok() && recall_sampled) {
+        // files not indexed yet are searched too, the sample is labeled by the index of the collection
+        meta::CollectionSchema collection_schema;
+        collection_schema.collection_id_ = collection_id;
+        if (DescribeCollection(collection_schema).ok()) {
+            recall_sampler_.Submit(collection_id, collection_schema.engine_type_, sampled_files, k, vectors,
+                                   result_ids);
+        }
+    }
+
+    if (status.ok() && !cache_key.empty()) {
+        auto obj = std::make_shared<QueryResultObj>(vectors, result_ids, result_distances);
+        if (obj->Size() <= query_cache->CacheCapacity()) {
+            query_cache->InsertItem(cache_key, obj);
+        }
+    }
+
     return status;
 }
 
+Status
+DBImpl::QueryMulti(const std::shared_ptr<server::Context>& context, std::vector<CollectionQuery>& queries) {
+    milvus::server::ContextChild tracer(context, "Query multi");
+
+    if (!initialized_.load(std::memory_order_acquire)) {
+        return SHUTDOWN_ERROR;
+    }
+
+    // step 1: collect files of all collections and construct a search job for each of them
+    TimeRecorder rc("");
+    std::vector<meta::FilesHolder> files_holders(queries.size());
+    std::vector<scheduler::SearchJobPtr> jobs(queries.size());
+    size_t file_count = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        auto& query = queries[i];
+        if (!query.status_.ok()) {
+            continue;
+        }
+
+        milvus::server::ContextChild meta_tracer(tracer.Context(), "Meta query");
+        meta_tracer.SetTag("collection", query.collection_id_);
+        query.status_ = CollectFilesToSearch(query.collection_id_, query.partition_tags_, files_holders[i]);
+        meta_tracer.Finish();
+        auto& files = files_holders[i].HoldFiles();
+        if (!query.status_.ok() || files.empty()) {
+            continue;  // no files to search
+        }
+
+        file_count += files.size();
+        if (file_count > milvus::scheduler::TASK_TABLE_MAX_COUNT) {
+            std::string msg =
+                "Search files count exceed scheduler limit: " + std::to_string(milvus::scheduler::TASK_TABLE_MAX_COUNT);
+            LOG_ENGINE_ERROR_ << msg;
+            return Status(DB_ERROR, msg);
+        }
+
+        jobs[i] = std::make_shared<scheduler::SearchJob>(tracer.Context(), query.k_, query.extra_params_,
+                                                         query.vectors_);
+        jobs[i]->set_collection_id(query.collection_id_);
+        AddFilesToSearchJob(jobs[i], files);
+    }
+    LOG_ENGINE_DEBUG_ << LogOut("Engine query multi begin, collection count: %ld, index file count: %ld",
+                                queries.size(), file_count);
+
+    // step 2: put all jobs to scheduler before waiting, so their tasks are loaded and executed together
+    SuspendIfFirst();
+    for (auto& job : jobs) {
+        if (job != nullptr) {
+            scheduler::JobMgrInst::GetInstance()->Put(job);
+        }
+    }
+    for (auto& job : jobs) {
+        if (job != nullptr) {
+            job->WaitResult();
+        }
+    }
+    ResumeIfLast();
+
+    // step 3: take over results of each job
+    for (size_t i = 0; i < queries.size(); ++i) {
+        files_holders[i].ReleaseFiles();
+        if (jobs[i] == nullptr) {
+            continue;
+        }
+
+        auto& query = queries[i];
+        query.status_ = jobs[i]->GetStatus();
+        if (query.status_.code() == SERVER_REQUEST_CANCELED) {
+            server::Metrics::GetInstance().SearchCanceledTotalIncrement();
+        } else if (query.status_.ok()) {
+            query.result_ids_.swap(jobs[i]->GetResultIds());
+            query.result_distances_.swap(jobs[i]->GetResultDistances());
+        }
+    }
+    rc.ElapseFromBegin("Engine query multi totally cost");
+
+    return Status::OK();
+}
+
 Status
 DBImpl::QueryByFileID(const std::shared_ptr<server::Context>& context, const std::vector<std::string>& file_ids,
                       uint64_t k, const milvus::json& extra_params, const VectorsData& vectors, ResultIds& result_ids,
@@ -1750,7 +1942,9 @@ DBImpl::QueryByFileID(const std::shared_ptr<server::Context>& context, const std
     }
 
     meta::FilesHolder files_holder;
+    milvus::server::ContextChild meta_tracer(tracer.Context(), "Meta query");
     auto status = meta_ptr_->FilesByID(ids, files_holder);
+    meta_tracer.Finish();
     if (!status.ok()) {
         return status;
     }
@@ -1760,8 +1954,19 @@ DBImpl::QueryByFileID(const std::shared_ptr<server::Context>& context, const std
         return Status(DB_ERROR, "Invalid file id");
     }
 
+    // files of a partition are charged to the collection owning it
+    meta::CollectionSchema collection_schema;
+    collection_schema.collection_id_ = search_files.front().collection_id_;
+    status = DescribeCollection(collection_schema);
+    if (!status.ok()) {
+        return status;
+    }
+    auto& collection_id = collection_schema.owner_collection_.empty() ? collection_schema.collection_id_
+                                                                      : collection_schema.owner_collection_;
+
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
-    status = QueryAsync(tracer.Context(), files_holder, k, extra_params, vectors, result_ids, result_distances);
+    status = QueryAsync(tracer.Context(), collection_id, files_holder, k, extra_params, vectors, result_ids,
+                        result_distances);
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
 
     return status;
@@ -1776,13 +1981,60 @@ DBImpl::Size(uint64_t& result) {
     return meta_ptr_->Size(result);
 }
 
+Status
+DBImpl::GetWalStatus(milvus::json& status) {
+    if (!initialized_.load(std::memory_order_acquire)) {
+        return SHUTDOWN_ERROR;
+    }
+
+    status["enable"] = options_.wal_enable_;
+    if (options_.wal_enable_ && wal_mgr_ != nullptr) {
+        wal_mgr_->GetBufferStatus(status);
+    }
+    return Status::OK();
+}
+
+Status
+DBImpl::FillSearchParams(const std::string& collection_id, int32_t engine_type, int64_t k, milvus::json& extra_params) {
+    if (search_tuner_.Fill(collection_id, engine_type, k, extra_params)) {
+        LOG_ENGINE_DEBUG_ << "Auto-tuned search params of " << collection_id << ": " << extra_params.dump();
+    }
+    return Status::OK();
+}
+
+Status
+DBImpl::SetSearchTuneTarget(const std::string& collection_id, float target_recall, int64_t latency_slo_ms) {
+    if (!initialized_.load(std::memory_order_acquire)) {
+        return SHUTDOWN_ERROR;
+    }
+
+    bool has_collection = false;
+    STATUS_CHECK(HasNativeCollection(collection_id, has_collection));
+    if (!has_collection) {
+        return Status(DB_NOT_FOUND, "Collection " + collection_id + " not found");
+    }
+
+    search_tuner_.SetTarget(collection_id, target_recall, latency_slo_ms);
+    return Status::OK();
+}
+
+Status
+DBImpl::GetSearchTuneStatus(const std::string& collection_id, milvus::json& status) {
+    if (!initialized_.load(std::memory_order_acquire)) {
+        return SHUTDOWN_ERROR;
+    }
+
+    status = search_tuner_.Dump(collection_id);
+    return Status::OK();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // internal methods
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 Status
-DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, meta::FilesHolder& files_holder, uint64_t k,
-                   const milvus::json& extra_params, const VectorsData& vectors, ResultIds& result_ids,
-                   ResultDistances& result_distances) {
+DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, const std::string& collection_id,
+                   meta::FilesHolder& files_holder, uint64_t k, const milvus::json& extra_params,
+                   const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) {
     milvus::server::ContextChild tracer(context, "Query Async");
     server::CollectQueryMetrics metrics(vectors.vector_count_);
 
@@ -1799,17 +2051,8 @@ DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, meta::FilesH
     // step 1: construct search job
     LOG_ENGINE_DEBUG_ << LogOut("Engine query begin, index file count: %ld", files.size());
     scheduler::SearchJobPtr job = std::make_shared<scheduler::SearchJob>(tracer.Context(), k, extra_params, vectors);
-    for (auto& file : files) {
-        // no need to process shadow files
-        if (file.file_type_ == milvus::engine::meta::SegmentSchema::FILE_TYPE::NEW ||
-            file.file_type_ == milvus::engine::meta::SegmentSchema::FILE_TYPE::NEW_MERGE ||
-            file.file_type_ == milvus::engine::meta::SegmentSchema::FILE_TYPE::NEW_INDEX) {
-            continue;
-        }
-
-        scheduler::SegmentSchemaPtr file_ptr = std::make_shared<meta::SegmentSchema>(file);
-        job->AddIndexFile(file_ptr);
-    }
+    job->set_collection_id(collection_id);
+    AddFilesToSearchJob(job, files);
 
     // Suspend builder
     SuspendIfFirst();
@@ -1823,12 +2066,15 @@ DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, meta::FilesH
 
     files_holder.ReleaseFiles();
     if (!job->GetStatus().ok()) {
+        if (job->GetStatus().code() == SERVER_REQUEST_CANCELED) {
+            server::Metrics::GetInstance().SearchCanceledTotalIncrement();
+        }
         return job->GetStatus();
     }
 
-    // step 3: construct results
-    result_ids = job->GetResultIds();
-    result_distances = job->GetResultDistances();
+    // step 3: construct results, the job is released after query, take over its result buffers
+    result_ids.swap(job->GetResultIds());
+    result_distances.swap(job->GetResultDistances());
     rc.ElapseFromBegin("Engine query totally cost");
 
     return Status::OK();
@@ -1889,6 +2135,43 @@ DBImpl::StartMetricTask() {
     }
 
     server::Metrics::GetInstance().GpuCacheUsageGaugeSet();
+
+    auto cpu_cache = cache::CpuCacheMgr::GetInstance();
+    server::Metrics::GetInstance().CpuCacheStatsSet(cpu_cache->ItemCount(), cpu_cache->HitCount(),
+                                                    cpu_cache->MissCount(), cpu_cache->EvictionCount());
+
+    // finished items stay in the task table until overwritten, only unfinished states reflect queue depth
+    static const std::vector<scheduler::TaskTableItemState> queued_states = {
+        scheduler::TaskTableItemState::START,     scheduler::TaskTableItemState::LOADING,
+        scheduler::TaskTableItemState::LOADED,    scheduler::TaskTableItemState::EXECUTING,
+        scheduler::TaskTableItemState::MOVING,
+    };
+    for (auto& resource : scheduler::ResMgrInst::GetInstance()->GetAllResources()) {
+        auto count = resource->task_table().StateCount();
+        for (auto state : queued_states) {
+            auto name = scheduler::ToString(state);
+            server::Metrics::GetInstance().TaskTableStateGaugeSet(resource->name(), name, count[name]);
+        }
+    }
+
+    auto build_mgr = scheduler::BuildMgrInst::GetInstance();
+    auto build_available = build_mgr->NumOfAvailable();
+    server::Metrics::GetInstance().BuildIndexSlotsGaugeSet(build_mgr->NumOfSlots() - build_available,
+                                                           build_available);
+
+    if (options_.wal_enable_ && wal_mgr_ != nullptr) {
+        milvus::json wal_status;
+        wal_mgr_->GetBufferStatus(wal_status);
+        if (wal_status.contains("buffer_size")) {
+            server::Metrics::GetInstance().WalBufferGaugeSet(wal_status["buffer_used"].get<double>(),
+                                                             wal_status["buffer_size"].get<double>());
+        }
+    }
+
+    auto cache_bytes = cpu_cache->GroupSize(utils::GetCollectionIdFromPath);
+    server::CollectionAccounting::GetInstance().SetCacheBytes(cache_bytes);
+    server::CollectionAccounting::GetInstance().Export();
+
     uint64_t size;
     Size(size);
     server::Metrics::GetInstance().DataFileSizeGaugeSet(size);
@@ -2329,6 +2612,10 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
                                              (record.data_size / record.length / sizeof(uint8_t)),
                                              (const u_int8_t*)record.data, record.lsn);
             force_flush_if_mem_full();
+            if (status.ok()) {
+                server::CollectionAccounting::GetInstance().AddInsert(target_collection_name, record.length,
+                                                                      record.data_size);
+            }
 
             // metrics
             milvus::server::CollectInsertMetrics metrics(record.length, status);
@@ -2347,6 +2634,10 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
                                              (record.data_size / record.length / sizeof(float)),
                                              (const float*)record.data, record.lsn);
             force_flush_if_mem_full();
+            if (status.ok()) {
+                server::CollectionAccounting::GetInstance().AddInsert(target_collection_name, record.length,
+                                                                      record.data_size);
+            }
 
             // metrics
             milvus::server::CollectInsertMetrics metrics(record.length, status);
@@ -27,10 +27,13 @@
 #include "config/handler/EngineConfigHandler.h"
 #include "db/DB.h"
 #include "db/IndexFailedChecker.h"
+#include "db/RecallSampler.h"
+#include "db/SearchTuner.h"
 #include "db/Types.h"
 #include "db/insert/MemManager.h"
 #include "db/merge/MergeManager.h"
 #include "db/meta/FilesHolder.h"
+#include "segment/IdBloomFilter.h"
 #include "utils/ThreadPool.h"
 #include "wal/WalManager.h"
 
@@ -160,6 +163,9 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
           const std::vector<std::string>& partition_tags, uint64_t k, const milvus::json& extra_params,
           const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) override;
 
+    Status
+    QueryMulti(const std::shared_ptr<server::Context>& context, std::vector<CollectionQuery>& queries) override;
+
     Status
     QueryByFileID(const std::shared_ptr<server::Context>& context, const std::vector<std::string>& file_ids, uint64_t k,
                   const milvus::json& extra_params, const VectorsData& vectors, ResultIds& result_ids,
@@ -168,6 +174,19 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     Status
     Size(uint64_t& result) override;
 
+    Status
+    GetWalStatus(milvus::json& status) override;
+
+    Status
+    FillSearchParams(const std::string& collection_id, int32_t engine_type, int64_t k,
+                     milvus::json& extra_params) override;
+
+    Status
+    SetSearchTuneTarget(const std::string& collection_id, float target_recall, int64_t latency_slo_ms) override;
+
+    Status
+    GetSearchTuneStatus(const std::string& collection_id, milvus::json& status) override;
+
  protected:
     void
     OnCacheInsertDataChanged(bool value) override;
@@ -177,14 +196,17 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
 
  private:
     Status
-    QueryAsync(const std::shared_ptr<server::Context>& context, meta::FilesHolder& files_holder, uint64_t k,
-               const milvus::json& extra_params, const VectorsData& vectors, ResultIds& result_ids,
-               ResultDistances& result_distances);
+    QueryAsync(const std::shared_ptr<server::Context>& context, const std::string& collection_id,
+               meta::FilesHolder& files_holder, uint64_t k, const milvus::json& extra_params,
+               const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances);
 
     Status
     GetVectorsByIdHelper(const IDNumbers& id_array, std::vector<engine::VectorsData>& vectors,
                          meta::FilesHolder& files_holder);
 
+    Status
+    LoadIdBloomFilter(const meta::SegmentSchema& file, segment::IdBloomFilterPtr& id_bloom_filter_ptr);
+
     void
     InternalFlush(const std::string& collection_id = "");
 
@@ -339,10 +361,15 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     std::mutex index_result_mutex_;
     std::list<std::future<void>> index_thread_results_;
 
+    ThreadPool id_probe_thread_pool_;
+
     std::mutex build_index_mutex_;
 
     IndexFailedChecker index_failed_checker_;
 
+    RecallSampler recall_sampler_;
+    SearchTuner search_tuner_;
+
     std::mutex flush_merge_compact_mutex_;
 
     int64_t live_search_num_ = 0;
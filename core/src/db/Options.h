@@ -60,6 +60,7 @@ struct DBMetaOptions {
     std::vector<std::string> slave_paths_;
     std::string backend_uri_;
     ArchiveConf archive_conf_ = ArchiveConf("delete");
+    bool cache_enable_ = false;  // serve search-path meta reads from memory
 };  // DBMetaOptions
 
 struct DBOptions {
@@ -77,6 +78,14 @@ struct DBOptions {
 
     bool metric_enable_ = false;
 
+    // fraction of searches re-run as exact brute force to measure recall
+    float recall_sample_ratio_ = 0.0;
+
+    // search params omitted by clients are tuned to reach this recall, 0 disables the tuning
+    float auto_tune_target_recall_ = 0.0;
+    // latency bound of the tuned search params in milliseconds, 0 means no bound
+    int64_t auto_tune_latency_slo_ms_ = 0;
+
     // wal relative configurations
     bool wal_enable_ = true;
     bool recovery_error_ignore_ = true;
@@ -0,0 +1,75 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/QueryResultCache.h"
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+
+namespace milvus {
+namespace engine {
+
+QueryResultObj::QueryResultObj(const VectorsData& vectors, const ResultIds& result_ids,
+                               const ResultDistances& result_distances)
+    : vector_count_(vectors.vector_count_),
+      float_data_(vectors.float_data_),
+      binary_data_(vectors.binary_data_),
+      result_ids_(result_ids),
+      result_distances_(result_distances) {
+}
+
+bool
+QueryResultObj::Match(const VectorsData& vectors) const {
+    return vector_count_ == vectors.vector_count_ && float_data_ == vectors.float_data_ &&
+           binary_data_ == vectors.binary_data_;
+}
+
+int64_t
+QueryResultObj::Size() {
+    return float_data_.size() * sizeof(float) + binary_data_.size() +
+           result_ids_.size() * sizeof(ResultIds::value_type) +
+           result_distances_.size() * sizeof(ResultDistances::value_type);
+}
+
+std::string
+QueryCacheKey(const std::string& collection_id, const std::vector<std::string>& partition_tags, uint64_t k,
+              const milvus::json& extra_params, const VectorsData& vectors, const meta::SegmentsSchema& files) {
+    std::vector<std::string> tags = partition_tags;
+    std::sort(tags.begin(), tags.end());
+
+    std::string file_signature;
+    for (auto& file : files) {
+        file_signature += file.file_id_ + ":" + std::to_string(file.file_type_) + ":" +
+                          std::to_string(file.row_count_) + ":" + std::to_string(file.updated_time_) + ";";
+    }
+
+    std::string vector_bytes;
+    if (!vectors.float_data_.empty()) {
+        vector_bytes.assign(reinterpret_cast<const char*>(vectors.float_data_.data()),
+                            vectors.float_data_.size() * sizeof(float));
+    } else {
+        vector_bytes.assign(vectors.binary_data_.begin(), vectors.binary_data_.end());
+    }
+
+    std::hash<std::string> hasher;
+    std::stringstream key;
+    key << collection_id << "|";
+    for (auto& tag : tags) {
+        key << tag << ",";
+    }
+    key << "|" << k << "|" << extra_params.dump() << "|" << std::hex << hasher(file_signature) << "|"
+        << vectors.vector_count_ << ":" << hasher(vector_bytes);
+    return key.str();
+}
+
+}  // namespace engine
+}  // namespace milvus
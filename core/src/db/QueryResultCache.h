@@ -0,0 +1,64 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cache/DataObj.h"
+#include "db/Types.h"
+#include "db/meta/MetaTypes.h"
+#include "utils/Json.h"
+
+namespace milvus {
+namespace engine {
+
+class QueryResultObj : public cache::DataObj {
+ public:
+    QueryResultObj(const VectorsData& vectors, const ResultIds& result_ids, const ResultDistances& result_distances);
+
+    // the key only holds a hash of the query vectors, compare the bytes to rule out collisions
+    bool
+    Match(const VectorsData& vectors) const;
+
+    int64_t
+    Size() override;
+
+    const ResultIds&
+    Ids() const {
+        return result_ids_;
+    }
+
+    const ResultDistances&
+    Distances() const {
+        return result_distances_;
+    }
+
+ private:
+    uint64_t vector_count_ = 0;
+    std::vector<float> float_data_;
+    std::vector<uint8_t> binary_data_;
+    ResultIds result_ids_;
+    ResultDistances result_distances_;
+};
+
+using QueryResultObjPtr = std::shared_ptr<QueryResultObj>;
+
+// Files to search are part of the key, so a flush, merge, index build or delete on any segment
+// makes the old results unreachable and they are evicted by LRU.
+std::string
+QueryCacheKey(const std::string& collection_id, const std::vector<std::string>& partition_tags, uint64_t k,
+              const milvus::json& extra_params, const VectorsData& vectors, const meta::SegmentsSchema& files);
+
+}  // namespace engine
+}  // namespace milvus
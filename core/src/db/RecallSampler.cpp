@@ -0,0 +1,215 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/RecallSampler.h"
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "db/Utils.h"
+#include "db/engine/EngineFactory.h"
+#include "metrics/Metrics.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace engine {
+
+namespace {
+// leading queries of a sampled search that are re-run, bounds the cost of one sample
+constexpr uint64_t RECALL_SAMPLE_MAX_NQ = 16;
+// sampled searches queued for the background lane, more are dropped
+constexpr int64_t RECALL_SAMPLE_MAX_PENDING = 4;
+// the brute force engine gets a location of its own, so the cached index of the file is not picked up
+const char* RECALL_SAMPLE_LOCATION = "/recall_sample";
+}  // namespace
+
+RecallSampler::RecallSampler(float ratio)
+    : ratio_(ratio), pending_(0), thread_pool_(1, RECALL_SAMPLE_MAX_PENDING + 1) {
+    if (ratio_ > 0.0) {
+        // the lane only yields cpu to searches, it never competes with them
+        thread_pool_.enqueue([]() {
+            SetThreadName("recall_sample");
+            setpriority(PRIO_PROCESS, syscall(SYS_gettid), 19);
+        });
+    }
+}
+
+bool
+RecallSampler::Sample() {
+    if (ratio_ <= 0.0) {
+        return false;
+    }
+    thread_local std::mt19937 generator(std::random_device{}());
+    std::uniform_real_distribution<float> distribution(0.0, 1.0);
+    return distribution(generator) < ratio_;
+}
+
+void
+RecallSampler::Submit(const std::string& collection_id, int32_t engine_type, const meta::SegmentsSchema& files,
+                      uint64_t k, const VectorsData& vectors, const ResultIds& result_ids) {
+    if (files.empty() || k == 0 || vectors.vector_count_ == 0) {
+        return;
+    }
+    if (pending_.fetch_add(1) >= RECALL_SAMPLE_MAX_PENDING) {
+        pending_--;
+        return;
+    }
+
+    // copy the leading queries, the caller releases its buffers once the search returns
+    uint64_t nq = std::min(vectors.vector_count_, RECALL_SAMPLE_MAX_NQ);
+    VectorsData sampled;
+    sampled.vector_count_ = nq;
+    if (!vectors.float_data_.empty()) {
+        auto dim = vectors.float_data_.size() / vectors.vector_count_;
+        sampled.float_data_.assign(vectors.float_data_.begin(), vectors.float_data_.begin() + nq * dim);
+    } else {
+        auto code_length = vectors.binary_data_.size() / vectors.vector_count_;
+        sampled.binary_data_.assign(vectors.binary_data_.begin(), vectors.binary_data_.begin() + nq * code_length);
+    }
+    ResultIds sampled_ids(result_ids.begin(), result_ids.begin() + std::min(result_ids.size(), nq * k));
+
+    thread_pool_.enqueue(&RecallSampler::Run, this, collection_id, engine_type, files, k, sampled, sampled_ids);
+}
+
+Status
+RecallSampler::Evaluate(const meta::SegmentsSchema& files, uint64_t k, const VectorsData& vectors,
+                        const ResultIds& result_ids, double& recall) {
+    uint64_t nq = vectors.vector_count_;
+    if (files.empty() || nq == 0 || k == 0 || result_ids.size() < nq * k) {
+        return Status(DB_ERROR, "Nothing to evaluate");
+    }
+
+    ResultIds exact_ids;
+    STATUS_CHECK(GroundTruth(files, k, vectors, exact_ids));
+    return Recall(exact_ids, result_ids, nq, k, recall);
+}
+
+Status
+RecallSampler::GroundTruth(const meta::SegmentsSchema& files, uint64_t k, const VectorsData& vectors,
+                           ResultIds& exact_ids) {
+    uint64_t nq = vectors.vector_count_;
+    if (files.empty() || nq == 0 || k == 0) {
+        return Status(DB_ERROR, "Nothing to search");
+    }
+
+    bool binary = vectors.float_data_.empty();
+    bool ascending = files.front().metric_type_ != static_cast<int32_t>(MetricType::IP);
+
+    // exact top k of each query in each file
+    std::vector<std::vector<std::pair<float, int64_t>>> candidates(nq);
+    ResultIds ids(nq * k);
+    ResultDistances distances(nq * k);
+    for (auto& file : files) {
+        std::string segment_dir;
+        utils::GetParentPath(file.location_, segment_dir);
+        auto engine_type = binary ? EngineType::FAISS_BIN_IDMAP : EngineType::FAISS_IDMAP;
+        auto engine = EngineFactory::Build(file.dimension_, segment_dir + RECALL_SAMPLE_LOCATION, engine_type,
+                                           (MetricType)file.metric_type_, milvus::json(), file.updated_time_);
+        if (engine == nullptr) {
+            return Status(DB_ERROR, "Failed to create brute force engine");
+        }
+
+        try {
+            STATUS_CHECK(engine->Load(true, false));
+            if (binary) {
+                STATUS_CHECK(engine->Search(nq, vectors.binary_data_.data(), k, milvus::json(), distances.data(),
+                                            ids.data(), false));
+            } else {
+                STATUS_CHECK(engine->Search(nq, vectors.float_data_.data(), k, milvus::json(), distances.data(),
+                                            ids.data(), false));
+            }
+        } catch (std::exception& ex) {
+            return Status(DB_ERROR, ex.what());
+        }
+
+        for (uint64_t i = 0; i < nq * k; ++i) {
+            if (ids[i] >= 0) {
+                candidates[i / k].emplace_back(distances[i], ids[i]);
+            }
+        }
+    }
+
+    MergeTopK(candidates, k, ascending, exact_ids);
+    return Status::OK();
+}
+
+Status
+RecallSampler::Recall(const ResultIds& exact_ids, const ResultIds& result_ids, uint64_t nq, uint64_t k,
+                      double& recall) {
+    if (nq == 0 || k == 0 || exact_ids.size() < nq * k || result_ids.size() < nq * k) {
+        return Status(DB_ERROR, "Nothing to evaluate");
+    }
+
+    double total = 0.0;
+    uint64_t evaluated = 0;
+    for (uint64_t i = 0; i < nq; ++i) {
+        std::unordered_set<int64_t> approximate(result_ids.begin() + i * k, result_ids.begin() + (i + 1) * k);
+        size_t hit = 0, topk = 0;
+        for (uint64_t j = i * k; j < (i + 1) * k && exact_ids[j] >= 0; ++j) {
+            hit += approximate.count(exact_ids[j]);
+            ++topk;
+        }
+        if (topk == 0) {
+            continue;
+        }
+        total += static_cast<double>(hit) / topk;
+        ++evaluated;
+    }
+
+    if (evaluated == 0) {
+        return Status(DB_ERROR, "No vectors to evaluate");
+    }
+    recall = total / evaluated;
+    return Status::OK();
+}
+
+void
+RecallSampler::MergeTopK(std::vector<std::vector<std::pair<float, int64_t>>>& candidates, uint64_t k,
+                         bool ascending, ResultIds& ids) {
+    ids.assign(candidates.size() * k, -1);
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        auto& query = candidates[i];
+        auto topk = std::min(static_cast<size_t>(k), query.size());
+        std::partial_sort(query.begin(), query.begin() + topk, query.end(), [ascending](auto& left, auto& right) {
+            return ascending ? left.first < right.first : left.first > right.first;
+        });
+        for (size_t j = 0; j < topk; ++j) {
+            ids[i * k + j] = query[j].second;
+        }
+    }
+}
+
+void
+RecallSampler::Run(const std::string& collection_id, int32_t engine_type, const meta::SegmentsSchema& files,
+                   uint64_t k, const VectorsData& vectors, const ResultIds& result_ids) {
+    // files released by the search may be merged away meanwhile, such samples are skipped
+    double recall = 0.0;
+    auto status = Evaluate(files, k, vectors, result_ids, recall);
+    if (status.ok()) {
+        auto index_type = utils::GetIndexName(engine_type);
+        auto collection = server::CollectionAccounting::GetInstance().Label(collection_id);
+        server::Metrics::GetInstance().SearchRecallHistogramObserve(collection, index_type, recall);
+        LOG_ENGINE_DEBUG_ << "Recall@" << k << " of " << collection_id << "(" << index_type << "): " << recall;
+    } else {
+        LOG_ENGINE_DEBUG_ << "Skip recall sample of " << collection_id << ": " << status.message();
+    }
+    pending_--;
+}
+
+}  // namespace engine
+}  // namespace milvus
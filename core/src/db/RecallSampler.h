@@ -0,0 +1,73 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include "db/Types.h"
+#include "db/meta/MetaTypes.h"
+#include "utils/Status.h"
+#include "utils/ThreadPool.h"
+
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+
+// Re-runs a sample of searches as exact brute force over the same files on a background thread, the recall of
+// the approximate results is exported per collection and index type.
+class RecallSampler {
+ public:
+    explicit RecallSampler(float ratio);
+
+    // decide whether the coming search is sampled
+    bool
+    Sample();
+
+    // queue a sampled search that succeeded, dropped when the background lane is busy. The recall is labeled by
+    // engine_type, the index of the collection, whatever mix of raw and indexed files was searched.
+    void
+    Submit(const std::string& collection_id, int32_t engine_type, const meta::SegmentsSchema& files, uint64_t k,
+           const VectorsData& vectors, const ResultIds& result_ids);
+
+    // recall@k of result_ids against exact brute force over files, averaged over the queries
+    static Status
+    Evaluate(const meta::SegmentsSchema& files, uint64_t k, const VectorsData& vectors, const ResultIds& result_ids,
+             double& recall);
+
+    // exact top k ids of each query over files, padded with -1 when the files hold less than k vectors
+    static Status
+    GroundTruth(const meta::SegmentsSchema& files, uint64_t k, const VectorsData& vectors, ResultIds& exact_ids);
+
+    // recall@k of result_ids against exact_ids, averaged over the queries
+    static Status
+    Recall(const ResultIds& exact_ids, const ResultIds& result_ids, uint64_t nq, uint64_t k, double& recall);
+
+    // top k ids of each query among the per file results gathered in candidates, padded with -1
+    static void
+    MergeTopK(std::vector<std::vector<std::pair<float, int64_t>>>& candidates, uint64_t k, bool ascending,
+              ResultIds& ids);
+
+ private:
+    void
+    Run(const std::string& collection_id, int32_t engine_type, const meta::SegmentsSchema& files, uint64_t k,
+        const VectorsData& vectors, const ResultIds& result_ids);
+
+ private:
+    float ratio_;
+    std::atomic<int64_t> pending_;
+    ThreadPool thread_pool_;
+};
+
+}  // namespace engine
+}  // namespace milvus
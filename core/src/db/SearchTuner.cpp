@@ -0,0 +1,430 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/SearchTuner.h"
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "db/RecallSampler.h"
+#include "db/Utils.h"
+#include "db/engine/EngineFactory.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace engine {
+
+namespace {
+// queries kept per collection, the tuning starts once there are as many of them
+constexpr uint64_t SEARCH_TUNE_NQ = 16;
+// collections queued for the background lane, more wait for their next search
+constexpr int64_t SEARCH_TUNE_MAX_PENDING = 8;
+// the indexed rows may change by this fraction before the collection is re-tuned
+constexpr double SEARCH_TUNE_ROWS_DRIFT = 0.1;
+
+constexpr int64_t SEARCH_TUNE_MAX_NPROBE = 65536;
+constexpr int64_t SEARCH_TUNE_MAX_EF = 32768;
+constexpr int64_t SEARCH_TUNE_DEFAULT_N_TREES = 8;
+
+// a raw file has the segment id as file id, only index files have a search param
+bool
+IsIndexFile(const meta::SegmentSchema& file) {
+    return file.segment_id_ != file.file_id_ && !SearchTuner::ParamName(file.engine_type_).empty();
+}
+
+int64_t
+IndexParam(const milvus::json& index_params, const char* name, int64_t default_value) {
+    if (index_params.contains(name) && index_params[name].is_number_integer()) {
+        return index_params[name].get<int64_t>();
+    }
+    return default_value;
+}
+
+// growing values of the search param, in the spirit of the faiss ParameterSpace
+std::vector<int64_t>
+Candidates(int32_t engine_type, uint64_t k, const milvus::json& index_params) {
+    std::vector<int64_t> values;
+    switch (static_cast<EngineType>(engine_type)) {
+        case EngineType::FAISS_IVFFLAT:
+        case EngineType::FAISS_IVFSQ8:
+        case EngineType::FAISS_IVFSQ8H:
+        case EngineType::FAISS_BIN_IVFFLAT:
+        case EngineType::FAISS_PQ: {
+            int64_t nlist = IndexParam(index_params, knowhere::IndexParams::nlist, SEARCH_TUNE_MAX_NPROBE);
+            int64_t max_nprobe = std::max<int64_t>(1, std::min(nlist, SEARCH_TUNE_MAX_NPROBE));
+            for (int64_t nprobe = 1; nprobe < max_nprobe; nprobe *= 2) {
+                values.push_back(nprobe);
+            }
+            values.push_back(max_nprobe);
+            break;
+        }
+        case EngineType::HNSW: {
+            for (int64_t ef = std::max<int64_t>(k, 16); ef < SEARCH_TUNE_MAX_EF; ef *= 2) {
+                values.push_back(ef);
+            }
+            values.push_back(SEARCH_TUNE_MAX_EF);
+            break;
+        }
+        case EngineType::NSG_MIX: {
+            values = {10, 20, 40, 80, 160, 300};
+            break;
+        }
+        case EngineType::ANNOY: {
+            int64_t n_trees = IndexParam(index_params, knowhere::IndexParams::n_trees, SEARCH_TUNE_DEFAULT_N_TREES);
+            for (int i = 0; i < 10; ++i) {
+                values.push_back((static_cast<int64_t>(k) * n_trees) << i);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return values;
+}
+
+void
+AppendQueries(VectorsData& queries, const VectorsData& vectors) {
+    uint64_t count = std::min(vectors.vector_count_, SEARCH_TUNE_NQ - queries.vector_count_);
+    if (!vectors.float_data_.empty()) {
+        auto dim = vectors.float_data_.size() / vectors.vector_count_;
+        queries.float_data_.insert(queries.float_data_.end(), vectors.float_data_.begin(),
+                                   vectors.float_data_.begin() + count * dim);
+    } else {
+        auto code_length = vectors.binary_data_.size() / vectors.vector_count_;
+        queries.binary_data_.insert(queries.binary_data_.end(), vectors.binary_data_.begin(),
+                                    vectors.binary_data_.begin() + count * code_length);
+    }
+    queries.vector_count_ += count;
+}
+}  // namespace
+
+SearchTuner::SearchTuner(float target_recall, int64_t latency_slo_ms)
+    : target_recall_(target_recall),
+      latency_slo_ms_(latency_slo_ms),
+      pending_(0),
+      thread_pool_(1, SEARCH_TUNE_MAX_PENDING + 1) {
+    // the lane only yields cpu to searches, it never competes with them
+    thread_pool_.enqueue([]() {
+        SetThreadName("search_tune");
+        setpriority(PRIO_PROCESS, syscall(SYS_gettid), 19);
+    });
+}
+
+void
+SearchTuner::Observe(const std::string& collection_id, const meta::SegmentsSchema& files, uint64_t k,
+                     const VectorsData& vectors) {
+    if (files.empty() || k == 0 || vectors.vector_count_ == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = collections_.find(collection_id);
+    if (iter == collections_.end()) {
+        if (target_recall_ <= 0.0) {
+            return;
+        }
+        iter = collections_.emplace(collection_id, CollectionTune()).first;
+        iter->second.target_recall_ = target_recall_;
+        iter->second.latency_slo_ms_ = latency_slo_ms_;
+    }
+    auto& tune = iter->second;
+    if (tune.target_recall_ <= 0.0 || tune.tuning_) {
+        return;
+    }
+
+    // step 1: keep the leading queries of the searches until there are enough of them
+    if (tune.queries_.vector_count_ < SEARCH_TUNE_NQ) {
+        AppendQueries(tune.queries_, vectors);
+    }
+    tune.k_ = std::max(tune.k_, k);
+    if (tune.queries_.vector_count_ < SEARCH_TUNE_NQ) {
+        return;
+    }
+
+    // step 2: re-tune when the index type or the indexed rows changed
+    int32_t engine_type = -1;
+    uint64_t rows = 0;
+    for (auto& file : files) {
+        if (!IsIndexFile(file)) {
+            continue;
+        }
+        if (engine_type < 0) {
+            engine_type = file.engine_type_;
+        }
+        if (file.engine_type_ == engine_type) {
+            rows += file.row_count_;
+        }
+    }
+    if (engine_type < 0) {
+        return;
+    }
+
+    auto drift = static_cast<double>(std::max(rows, tune.tuned_rows_) - std::min(rows, tune.tuned_rows_));
+    if (tune.tuned_ && engine_type == tune.engine_type_ && drift <= SEARCH_TUNE_ROWS_DRIFT * tune.tuned_rows_) {
+        return;
+    }
+    if (pending_.fetch_add(1) >= SEARCH_TUNE_MAX_PENDING) {
+        pending_--;
+        return;
+    }
+
+    // step 3: tune over the index files on the background lane
+    meta::SegmentsSchema index_files;
+    for (auto& file : files) {
+        if (IsIndexFile(file) && file.engine_type_ == engine_type) {
+            index_files.push_back(file);
+        }
+    }
+    tune.tuning_ = true;
+    thread_pool_.enqueue(&SearchTuner::Run, this, collection_id, index_files, tune.k_, tune.queries_,
+                         tune.target_recall_, tune.latency_slo_ms_, rows);
+}
+
+bool
+SearchTuner::Fill(const std::string& collection_id, int32_t engine_type, int64_t k, milvus::json& extra_params) {
+    auto name = ParamName(engine_type);
+    if (name.empty() || !(extra_params.is_null() || extra_params.is_object()) || extra_params.contains(name)) {
+        return false;
+    }
+
+    int64_t value = -1;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = collections_.find(collection_id);
+        if (iter == collections_.end() || iter->second.engine_type_ != engine_type) {
+            return false;
+        }
+        value = iter->second.value_;
+    }
+    if (value < 0) {
+        return false;
+    }
+
+    if (engine_type == static_cast<int32_t>(EngineType::HNSW)) {
+        value = std::max(value, k);
+    }
+    extra_params[name] = value;
+    return true;
+}
+
+void
+SearchTuner::SetTarget(const std::string& collection_id, float target_recall, int64_t latency_slo_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& tune = collections_[collection_id];
+    tune.custom_target_ = true;
+    tune.target_recall_ = target_recall;
+    tune.latency_slo_ms_ = latency_slo_ms;
+    tune.tuned_ = false;
+    if (target_recall <= 0.0) {
+        tune.curve_.clear();
+        tune.value_ = -1;
+    }
+}
+
+void
+SearchTuner::Remove(const std::string& collection_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    collections_.erase(collection_id);
+}
+
+milvus::json
+SearchTuner::Dump(const std::string& collection_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    milvus::json ret;
+    auto iter = collections_.find(collection_id);
+    if (iter == collections_.end()) {
+        ret["target_recall"] = target_recall_;
+        ret["latency_slo_ms"] = latency_slo_ms_;
+        ret["tuned"] = false;
+        return ret;
+    }
+
+    auto& tune = iter->second;
+    ret["target_recall"] = tune.target_recall_;
+    ret["latency_slo_ms"] = tune.latency_slo_ms_;
+    ret["custom_target"] = tune.custom_target_;
+    ret["queries"] = tune.queries_.vector_count_;
+    ret["tuning"] = tune.tuning_;
+    ret["tuned"] = tune.value_ >= 0;
+    if (tune.value_ >= 0) {
+        ret["index_type"] = utils::GetIndexName(tune.engine_type_);
+        ret["param"] = ParamName(tune.engine_type_);
+        ret["value"] = tune.value_;
+        ret["rows"] = tune.tuned_rows_;
+    }
+    milvus::json curve = milvus::json::array();
+    for (auto& point : tune.curve_) {
+        curve.push_back({{"value", point.value_}, {"recall", point.recall_}, {"latency_ms", point.latency_ms_}});
+    }
+    ret["curve"] = curve;
+    return ret;
+}
+
+std::string
+SearchTuner::ParamName(int32_t engine_type) {
+    switch (static_cast<EngineType>(engine_type)) {
+        case EngineType::FAISS_IVFFLAT:
+        case EngineType::FAISS_IVFSQ8:
+        case EngineType::FAISS_IVFSQ8H:
+        case EngineType::FAISS_BIN_IVFFLAT:
+        case EngineType::FAISS_PQ:
+            return knowhere::IndexParams::nprobe;
+        case EngineType::HNSW:
+            return knowhere::IndexParams::ef;
+        case EngineType::NSG_MIX:
+            return knowhere::IndexParams::search_length;
+        case EngineType::ANNOY:
+            return knowhere::IndexParams::search_k;
+        default:
+            return "";
+    }
+}
+
+Status
+SearchTuner::Tune(const meta::SegmentsSchema& files, uint64_t k, const VectorsData& queries, float target_recall,
+                  int64_t latency_slo_ms, std::vector<OperatingPoint>& curve, int64_t& value) {
+    uint64_t nq = queries.vector_count_;
+    if (files.empty() || nq == 0 || k == 0) {
+        return Status(DB_ERROR, "Nothing to tune");
+    }
+    auto engine_type = files.front().engine_type_;
+    auto name = ParamName(engine_type);
+    if (name.empty()) {
+        return Status(DB_ERROR, "No search param to tune for index " + utils::GetIndexName(engine_type));
+    }
+
+    // step 1: exact results as ground truth
+    ResultIds exact_ids;
+    STATUS_CHECK(RecallSampler::GroundTruth(files, k, queries, exact_ids));
+
+    // step 2: load the indexes, mostly cached by the searches already
+    std::vector<ExecutionEnginePtr> engines;
+    milvus::json index_params;
+    try {
+        for (auto& file : files) {
+            milvus::json json_params;
+            if (!file.index_params_.empty()) {
+                json_params = milvus::json::parse(file.index_params_);
+            }
+            auto engine = EngineFactory::Build(file.dimension_, file.location_, (EngineType)file.engine_type_,
+                                               (MetricType)file.metric_type_, json_params, file.updated_time_);
+            if (engine == nullptr) {
+                return Status(DB_ERROR, "Failed to create engine of file " + file.file_id_);
+            }
+            STATUS_CHECK(engine->Load(true));
+            engines.emplace_back(engine);
+            index_params = json_params;
+        }
+    } catch (std::exception& ex) {
+        return Status(DB_ERROR, ex.what());
+    }
+
+    // step 3: walk up the candidate values until the target recall or the latency bound is reached
+    bool binary = queries.float_data_.empty();
+    bool ascending = files.front().metric_type_ != static_cast<int32_t>(MetricType::IP);
+    ResultIds ids(nq * k);
+    ResultDistances distances(nq * k);
+    curve.clear();
+    for (auto candidate : Candidates(engine_type, k, index_params)) {
+        milvus::json search_params = {{name, candidate}};
+        std::vector<std::vector<std::pair<float, int64_t>>> results(nq);
+        double search_ms = 0.0;
+        for (auto& engine : engines) {
+            auto start = std::chrono::steady_clock::now();
+            try {
+                if (binary) {
+                    STATUS_CHECK(engine->Search(nq, queries.binary_data_.data(), k, search_params, distances.data(),
+                                                ids.data(), false));
+                } else {
+                    STATUS_CHECK(engine->Search(nq, queries.float_data_.data(), k, search_params, distances.data(),
+                                                ids.data(), false));
+                }
+            } catch (std::exception& ex) {
+                return Status(DB_ERROR, ex.what());
+            }
+            search_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            for (uint64_t i = 0; i < nq * k; ++i) {
+                if (ids[i] >= 0) {
+                    results[i / k].emplace_back(distances[i], ids[i]);
+                }
+            }
+        }
+
+        ResultIds result_ids;
+        RecallSampler::MergeTopK(results, k, ascending, result_ids);
+        OperatingPoint point;
+        point.value_ = candidate;
+        point.latency_ms_ = search_ms / nq;
+        STATUS_CHECK(RecallSampler::Recall(exact_ids, result_ids, nq, k, point.recall_));
+        curve.emplace_back(point);
+
+        if (point.recall_ >= target_recall || (latency_slo_ms > 0 && point.latency_ms_ > latency_slo_ms)) {
+            break;
+        }
+    }
+    if (curve.empty()) {
+        return Status(DB_ERROR, "No candidate of " + name);
+    }
+
+    // step 4: the smallest value reaching the target within the bound, else the largest one within the bound
+    value = curve.front().value_;
+    for (auto& point : curve) {
+        if (latency_slo_ms > 0 && point.latency_ms_ > latency_slo_ms) {
+            break;
+        }
+        value = point.value_;
+        if (point.recall_ >= target_recall) {
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+void
+SearchTuner::Run(const std::string& collection_id, const meta::SegmentsSchema& files, uint64_t k,
+                 const VectorsData& queries, float target_recall, int64_t latency_slo_ms, uint64_t rows) {
+    // files released by the search may be merged away meanwhile, a failed round is retried once the rows change
+    std::vector<OperatingPoint> curve;
+    int64_t value = -1;
+    auto status = Tune(files, k, queries, target_recall, latency_slo_ms, curve, value);
+    if (status.ok()) {
+        LOG_ENGINE_DEBUG_ << "Search param of " << collection_id << " tuned: " << ParamName(files.front().engine_type_)
+                          << "=" << value;
+    } else {
+        LOG_ENGINE_DEBUG_ << "Failed to tune search param of " << collection_id << ": " << status.message();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = collections_.find(collection_id);
+        if (iter != collections_.end()) {
+            auto& tune = iter->second;
+            tune.tuning_ = false;
+            // a target set meanwhile asks for another round
+            tune.tuned_ = tune.target_recall_ == target_recall && tune.latency_slo_ms_ == latency_slo_ms;
+            tune.engine_type_ = files.front().engine_type_;
+            tune.tuned_rows_ = rows;
+            tune.curve_.swap(curve);
+            tune.value_ = status.ok() ? value : -1;
+        }
+    }
+    pending_--;
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,104 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include "db/Types.h"
+#include "db/meta/MetaTypes.h"
+#include "utils/Json.h"
+#include "utils/Status.h"
+#include "utils/ThreadPool.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+
+// Tunes the search param of each collection (nprobe, ef, search_k or search_length, by the index type) against a
+// target recall and a latency bound. Queries sampled from its searches are re-run over the indexed segments with
+// growing param values and compared with exact brute force, the resulting curve picks the value that fills the
+// param when a client omits it. The collection is re-tuned once its indexed rows change.
+class SearchTuner {
+ public:
+    struct OperatingPoint {
+        int64_t value_ = 0;
+        double recall_ = 0.0;
+        // one query over all the indexed segments on a single thread
+        double latency_ms_ = 0.0;
+    };
+
+    SearchTuner(float target_recall, int64_t latency_slo_ms);
+
+    // keep a few queries of a search and re-tune the collection on the background thread if needed
+    void
+    Observe(const std::string& collection_id, const meta::SegmentsSchema& files, uint64_t k,
+            const VectorsData& vectors);
+
+    // fill the search param of engine_type omitted in extra_params, false if the collection is not tuned
+    bool
+    Fill(const std::string& collection_id, int32_t engine_type, int64_t k, milvus::json& extra_params);
+
+    // overrides the configured targets for one collection, target_recall 0 disables its tuning
+    void
+    SetTarget(const std::string& collection_id, float target_recall, int64_t latency_slo_ms);
+
+    void
+    Remove(const std::string& collection_id);
+
+    milvus::json
+    Dump(const std::string& collection_id);
+
+    // name of the search param tuned for engine_type, empty if the index type has none
+    static std::string
+    ParamName(int32_t engine_type);
+
+    // evaluate growing values of the search param over files, stops once the target or the bound is reached
+    static Status
+    Tune(const meta::SegmentsSchema& files, uint64_t k, const VectorsData& queries, float target_recall,
+         int64_t latency_slo_ms, std::vector<OperatingPoint>& curve, int64_t& value);
+
+ private:
+    struct CollectionTune {
+        bool custom_target_ = false;
+        float target_recall_ = 0.0;
+        int64_t latency_slo_ms_ = 0;
+
+        VectorsData queries_;
+        uint64_t k_ = 0;
+
+        bool tuning_ = false;
+        bool tuned_ = false;
+        int32_t engine_type_ = 0;
+        uint64_t tuned_rows_ = 0;
+        std::vector<OperatingPoint> curve_;
+        int64_t value_ = -1;
+    };
+
+    void
+    Run(const std::string& collection_id, const meta::SegmentsSchema& files, uint64_t k, const VectorsData& queries,
+        float target_recall, int64_t latency_slo_ms, uint64_t rows);
+
+ private:
+    float target_recall_;
+    int64_t latency_slo_ms_;
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, CollectionTune> collections_;
+    std::atomic<int64_t> pending_;
+    ThreadPool thread_pool_;
+};
+
+}  // namespace engine
+}  // namespace milvus
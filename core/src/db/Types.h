@@ -24,6 +24,7 @@
 #include "db/engine/ExecutionEngine.h"
 #include "segment/Types.h"
 #include "utils/Json.h"
+#include "utils/Status.h"
 
 namespace milvus {
 namespace engine {
@@ -48,6 +49,18 @@ struct VectorsData {
     IDNumbers id_array_;
 };
 
+// one collection searched by a multi-collection query, results and status are filled by the query
+struct CollectionQuery {
+    std::string collection_id_;
+    std::vector<std::string> partition_tags_;
+    uint64_t k_ = 0;
+    milvus::json extra_params_;
+    VectorsData vectors_;
+    ResultIds result_ids_;
+    ResultDistances result_distances_;
+    Status status_;
+};
+
 struct Entity {
     uint64_t entity_count_ = 0;
     std::vector<uint8_t> attr_value_;
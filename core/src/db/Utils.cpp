@@ -206,6 +206,20 @@ GetParentPath(const std::string& path, std::string& parent_path) {
     return Status::OK();
 }
 
+std::string
+GetCollectionIdFromPath(const std::string& path) {
+    auto pos = path.rfind(TABLES_FOLDER);
+    if (pos == std::string::npos) {
+        return "";
+    }
+    pos += std::string(TABLES_FOLDER).size();
+    auto end = path.find('/', pos);
+    if (end == std::string::npos) {
+        return "";
+    }
+    return path.substr(pos, end - pos);
+}
+
 bool
 IsSameIndex(const CollectionIndex& index1, const CollectionIndex& index2) {
     return index1.engine_type_ == index2.engine_type_ && index1.extra_params_ == index2.extra_params_ &&
@@ -44,6 +44,10 @@ DeleteSegment(const DBMetaOptions& options, meta::SegmentSchema& table_file);
 Status
 GetParentPath(const std::string& path, std::string& parent_path);
 
+// collection id of a segment file path, empty if the path is not under a collection folder
+std::string
+GetCollectionIdFromPath(const std::string& path);
+
 bool
 IsSameIndex(const CollectionIndex& index1, const CollectionIndex& index2);
 
@@ -166,6 +166,8 @@ Status
 MemTableFile::Serialize(uint64_t wal_lsn) {
     int64_t size = GetCurrentMem();
     server::CollectSerializeMetrics metrics(size);
+    server::CollectCollectionTaskMetrics task_metrics(table_file_schema_.collection_id_,
+                                                      server::CollectionTaskType::FLUSH);
 
     auto status = segment_writer_ptr_->Serialize();
     if (!status.ok()) {
@@ -39,6 +39,7 @@ MergeTask::Execute() {
             return Status(DB_ERROR, "Cannot merge files across collections");
         }
     }
+    server::CollectCollectionTaskMetrics task_metrics(collection_id, server::CollectionTaskType::MERGE);
 
     // step 1: create collection file
     meta::SegmentSchema collection_file;
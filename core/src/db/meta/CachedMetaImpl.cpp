@@ -0,0 +1,332 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/meta/CachedMetaImpl.h"
+
+#include <memory>
+
+#include "metrics/Metrics.h"
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+CachedMetaImpl::CachedMetaImpl(const MetaPtr& meta) : meta_(meta) {
+}
+
+uint64_t
+CachedMetaImpl::Version() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return version_;
+}
+
+Status
+CachedMetaImpl::Invalidate(const Status& status) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++version_;
+    collections_.clear();
+    partitions_.clear();
+    files_to_search_.clear();
+    return status;
+}
+
+Status
+CachedMetaImpl::CachedFilesToSearch(const std::string& key, FilesHolder& files_holder,
+                                    const std::function<Status(FilesHolder&)>& load) {
+    uint64_t version = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = files_to_search_.find(key);
+        if (iter != files_to_search_.end()) {
+            server::Metrics::GetInstance().MetaCacheHitTotalIncrement();
+            return files_holder.MarkFiles(iter->second);
+        }
+        version = version_;
+    }
+
+    server::Metrics::GetInstance().MetaCacheMissTotalIncrement();
+    FilesHolder loaded_holder;
+    auto status = load(loaded_holder);
+    if (!status.ok()) {
+        return status;
+    }
+
+    auto& files = loaded_holder.HoldFiles();
+    {
+        // a write that finished while loading may have changed the result, only keep it if none did
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (version == version_) {
+            files_to_search_[key] = files;
+        }
+    }
+    return files_holder.MarkFiles(files);
+}
+
+Status
+CachedMetaImpl::CreateCollection(CollectionSchema& collection_schema) {
+    return Invalidate(meta_->CreateCollection(collection_schema));
+}
+
+Status
+CachedMetaImpl::DescribeCollection(CollectionSchema& collection_schema) {
+    uint64_t version = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = collections_.find(collection_schema.collection_id_);
+        if (iter != collections_.end()) {
+            server::Metrics::GetInstance().MetaCacheHitTotalIncrement();
+            collection_schema = iter->second;
+            return Status::OK();
+        }
+        version = version_;
+    }
+
+    server::Metrics::GetInstance().MetaCacheMissTotalIncrement();
+    auto status = meta_->DescribeCollection(collection_schema);
+    if (status.ok()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (version == version_) {
+            collections_[collection_schema.collection_id_] = collection_schema;
+        }
+    }
+    return status;
+}
+
+Status
+CachedMetaImpl::HasCollection(const std::string& collection_id, bool& has_or_not, bool is_root) {
+    return meta_->HasCollection(collection_id, has_or_not, is_root);
+}
+
+Status
+CachedMetaImpl::AllCollections(std::vector<CollectionSchema>& collection_schema_array, bool is_root) {
+    return meta_->AllCollections(collection_schema_array, is_root);
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFlag(const std::string& collection_id, int64_t flag) {
+    return Invalidate(meta_->UpdateCollectionFlag(collection_id, flag));
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFlushLSN(const std::string& collection_id, uint64_t flush_lsn) {
+    return Invalidate(meta_->UpdateCollectionFlushLSN(collection_id, flush_lsn));
+}
+
+Status
+CachedMetaImpl::GetCollectionFlushLSN(const std::string& collection_id, uint64_t& flush_lsn) {
+    return meta_->GetCollectionFlushLSN(collection_id, flush_lsn);
+}
+
+Status
+CachedMetaImpl::DropCollections(const std::vector<std::string>& collection_id_array) {
+    return Invalidate(meta_->DropCollections(collection_id_array));
+}
+
+Status
+CachedMetaImpl::DeleteCollectionFiles(const std::vector<std::string>& collection_id_array) {
+    return Invalidate(meta_->DeleteCollectionFiles(collection_id_array));
+}
+
+Status
+CachedMetaImpl::CreateCollectionFile(SegmentSchema& file_schema) {
+    return Invalidate(meta_->CreateCollectionFile(file_schema));
+}
+
+Status
+CachedMetaImpl::GetCollectionFiles(const std::string& collection_id, const std::vector<size_t>& ids,
+                                   FilesHolder& files_holder) {
+    return meta_->GetCollectionFiles(collection_id, ids, files_holder);
+}
+
+Status
+CachedMetaImpl::GetCollectionFilesBySegmentId(const std::string& segment_id, FilesHolder& files_holder) {
+    return meta_->GetCollectionFilesBySegmentId(segment_id, files_holder);
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFile(SegmentSchema& file_schema) {
+    return Invalidate(meta_->UpdateCollectionFile(file_schema));
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFiles(SegmentsSchema& files) {
+    return Invalidate(meta_->UpdateCollectionFiles(files));
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFilesRowCount(SegmentsSchema& files) {
+    return Invalidate(meta_->UpdateCollectionFilesRowCount(files));
+}
+
+Status
+CachedMetaImpl::UpdateCollectionIndex(const std::string& collection_id, const CollectionIndex& index) {
+    return Invalidate(meta_->UpdateCollectionIndex(collection_id, index));
+}
+
+Status
+CachedMetaImpl::UpdateCollectionFilesToIndex(const std::string& collection_id) {
+    return Invalidate(meta_->UpdateCollectionFilesToIndex(collection_id));
+}
+
+Status
+CachedMetaImpl::DescribeCollectionIndex(const std::string& collection_id, CollectionIndex& index) {
+    return meta_->DescribeCollectionIndex(collection_id, index);
+}
+
+Status
+CachedMetaImpl::DropCollectionIndex(const std::string& collection_id) {
+    return Invalidate(meta_->DropCollectionIndex(collection_id));
+}
+
+Status
+CachedMetaImpl::CreatePartition(const std::string& collection_id, const std::string& partition_name,
+                                const std::string& tag, uint64_t lsn) {
+    return Invalidate(meta_->CreatePartition(collection_id, partition_name, tag, lsn));
+}
+
+Status
+CachedMetaImpl::HasPartition(const std::string& collection_id, const std::string& tag, bool& has_or_not) {
+    return meta_->HasPartition(collection_id, tag, has_or_not);
+}
+
+Status
+CachedMetaImpl::DropPartition(const std::string& partition_name) {
+    return Invalidate(meta_->DropPartition(partition_name));
+}
+
+Status
+CachedMetaImpl::ShowPartitions(const std::string& collection_id,
+                               std::vector<meta::CollectionSchema>& partition_schema_array) {
+    uint64_t version = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = partitions_.find(collection_id);
+        if (iter != partitions_.end()) {
+            server::Metrics::GetInstance().MetaCacheHitTotalIncrement();
+            partition_schema_array = iter->second;
+            return Status::OK();
+        }
+        version = version_;
+    }
+
+    server::Metrics::GetInstance().MetaCacheMissTotalIncrement();
+    auto status = meta_->ShowPartitions(collection_id, partition_schema_array);
+    if (status.ok()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (version == version_) {
+            partitions_[collection_id] = partition_schema_array;
+        }
+    }
+    return status;
+}
+
+Status
+CachedMetaImpl::CountPartitions(const std::string& collection_id, int64_t& partition_count) {
+    return meta_->CountPartitions(collection_id, partition_count);
+}
+
+Status
+CachedMetaImpl::GetPartitionName(const std::string& collection_id, const std::string& tag,
+                                 std::string& partition_name) {
+    return meta_->GetPartitionName(collection_id, tag, partition_name);
+}
+
+Status
+CachedMetaImpl::FilesToSearch(const std::string& collection_id, FilesHolder& files_holder) {
+    return CachedFilesToSearch(collection_id, files_holder, [&](FilesHolder& holder) -> Status {
+        return meta_->FilesToSearch(collection_id, holder);
+    });
+}
+
+Status
+CachedMetaImpl::FilesToSearchEx(const std::string& root_collection, const std::set<std::string>& partition_id_array,
+                                FilesHolder& files_holder) {
+    // collection and partition names cannot contain '/', so the key is unambiguous
+    std::string key = root_collection;
+    for (auto& partition_id : partition_id_array) {
+        key += "/" + partition_id;
+    }
+    return CachedFilesToSearch(key, files_holder, [&](FilesHolder& holder) -> Status {
+        return meta_->FilesToSearchEx(root_collection, partition_id_array, holder);
+    });
+}
+
+Status
+CachedMetaImpl::FilesToMerge(const std::string& collection_id, FilesHolder& files_holder) {
+    return meta_->FilesToMerge(collection_id, files_holder);
+}
+
+Status
+CachedMetaImpl::FilesToIndex(FilesHolder& files_holder) {
+    return meta_->FilesToIndex(files_holder);
+}
+
+Status
+CachedMetaImpl::FilesByType(const std::string& collection_id, const std::vector<int>& file_types,
+                            FilesHolder& files_holder) {
+    return meta_->FilesByType(collection_id, file_types, files_holder);
+}
+
+Status
+CachedMetaImpl::FilesByTypeEx(const std::vector<meta::CollectionSchema>& collections,
+                              const std::vector<int>& file_types, FilesHolder& files_holder) {
+    return meta_->FilesByTypeEx(collections, file_types, files_holder);
+}
+
+Status
+CachedMetaImpl::FilesByID(const std::vector<size_t>& ids, FilesHolder& files_holder) {
+    return meta_->FilesByID(ids, files_holder);
+}
+
+Status
+CachedMetaImpl::Size(uint64_t& result) {
+    return meta_->Size(result);
+}
+
+Status
+CachedMetaImpl::Archive() {
+    return Invalidate(meta_->Archive());
+}
+
+// clean up only removes shadow and soft-deleted rows, none of which is visible to the cached reads
+Status
+CachedMetaImpl::CleanUpShadowFiles() {
+    return meta_->CleanUpShadowFiles();
+}
+
+Status
+CachedMetaImpl::CleanUpFilesWithTTL(uint64_t seconds) {
+    return meta_->CleanUpFilesWithTTL(seconds);
+}
+
+Status
+CachedMetaImpl::DropAll() {
+    return Invalidate(meta_->DropAll());
+}
+
+Status
+CachedMetaImpl::Count(const std::string& collection_id, uint64_t& result) {
+    return meta_->Count(collection_id, result);
+}
+
+Status
+CachedMetaImpl::SetGlobalLastLSN(uint64_t lsn) {
+    return meta_->SetGlobalLastLSN(lsn);
+}
+
+Status
+CachedMetaImpl::GetGlobalLastLSN(uint64_t& lsn) {
+    return meta_->GetGlobalLastLSN(lsn);
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,183 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Meta.h"
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+// Keeps the meta reads of the search path in memory. Every write through this object bumps the version and
+// drops the snapshot, so it is only coherent while no other process writes the same backend.
+class CachedMetaImpl : public Meta {
+ public:
+    explicit CachedMetaImpl(const MetaPtr& meta);
+
+    uint64_t
+    Version();
+
+    Status
+    CreateCollection(CollectionSchema& collection_schema) override;
+
+    Status
+    DescribeCollection(CollectionSchema& collection_schema) override;
+
+    Status
+    HasCollection(const std::string& collection_id, bool& has_or_not, bool is_root = false) override;
+
+    Status
+    AllCollections(std::vector<CollectionSchema>& collection_schema_array, bool is_root = false) override;
+
+    Status
+    UpdateCollectionFlag(const std::string& collection_id, int64_t flag) override;
+
+    Status
+    UpdateCollectionFlushLSN(const std::string& collection_id, uint64_t flush_lsn) override;
+
+    Status
+    GetCollectionFlushLSN(const std::string& collection_id, uint64_t& flush_lsn) override;
+
+    Status
+    DropCollections(const std::vector<std::string>& collection_id_array) override;
+
+    Status
+    DeleteCollectionFiles(const std::vector<std::string>& collection_id_array) override;
+
+    Status
+    CreateCollectionFile(SegmentSchema& file_schema) override;
+
+    Status
+    GetCollectionFiles(const std::string& collection_id, const std::vector<size_t>& ids,
+                       FilesHolder& files_holder) override;
+
+    Status
+    GetCollectionFilesBySegmentId(const std::string& segment_id, FilesHolder& files_holder) override;
+
+    Status
+    UpdateCollectionFile(SegmentSchema& file_schema) override;
+
+    Status
+    UpdateCollectionFiles(SegmentsSchema& files) override;
+
+    Status
+    UpdateCollectionFilesRowCount(SegmentsSchema& files) override;
+
+    Status
+    UpdateCollectionIndex(const std::string& collection_id, const CollectionIndex& index) override;
+
+    Status
+    UpdateCollectionFilesToIndex(const std::string& collection_id) override;
+
+    Status
+    DescribeCollectionIndex(const std::string& collection_id, CollectionIndex& index) override;
+
+    Status
+    DropCollectionIndex(const std::string& collection_id) override;
+
+    Status
+    CreatePartition(const std::string& collection_id, const std::string& partition_name, const std::string& tag,
+                    uint64_t lsn) override;
+
+    Status
+    HasPartition(const std::string& collection_id, const std::string& tag, bool& has_or_not) override;
+
+    Status
+    DropPartition(const std::string& partition_name) override;
+
+    Status
+    ShowPartitions(const std::string& collection_id,
+                   std::vector<meta::CollectionSchema>& partition_schema_array) override;
+
+    Status
+    CountPartitions(const std::string& collection_id, int64_t& partition_count) override;
+
+    Status
+    GetPartitionName(const std::string& collection_id, const std::string& tag, std::string& partition_name) override;
+
+    Status
+    FilesToSearch(const std::string& collection_id, FilesHolder& files_holder) override;
+
+    Status
+    FilesToSearchEx(const std::string& root_collection, const std::set<std::string>& partition_id_array,
+                    FilesHolder& files_holder) override;
+
+    Status
+    FilesToMerge(const std::string& collection_id, FilesHolder& files_holder) override;
+
+    Status
+    FilesToIndex(FilesHolder& files_holder) override;
+
+    Status
+    FilesByType(const std::string& collection_id, const std::vector<int>& file_types,
+                FilesHolder& files_holder) override;
+
+    Status
+    FilesByTypeEx(const std::vector<meta::CollectionSchema>& collections, const std::vector<int>& file_types,
+                  FilesHolder& files_holder) override;
+
+    Status
+    FilesByID(const std::vector<size_t>& ids, FilesHolder& files_holder) override;
+
+    Status
+    Size(uint64_t& result) override;
+
+    Status
+    Archive() override;
+
+    Status
+    CleanUpShadowFiles() override;
+
+    Status
+    CleanUpFilesWithTTL(uint64_t seconds) override;
+
+    Status
+    DropAll() override;
+
+    Status
+    Count(const std::string& collection_id, uint64_t& result) override;
+
+    Status
+    SetGlobalLastLSN(uint64_t lsn) override;
+
+    Status
+    GetGlobalLastLSN(uint64_t& lsn) override;
+
+ private:
+    Status
+    Invalidate(const Status& status);
+
+    Status
+    CachedFilesToSearch(const std::string& key, FilesHolder& files_holder,
+                        const std::function<Status(FilesHolder&)>& load);
+
+ private:
+    MetaPtr meta_;
+
+    std::mutex mutex_;
+    uint64_t version_ = 0;
+    std::unordered_map<std::string, CollectionSchema> collections_;
+    std::unordered_map<std::string, std::vector<CollectionSchema>> partitions_;
+    std::map<std::string, SegmentsSchema> files_to_search_;
+};  // CachedMetaImpl
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -346,6 +346,13 @@ MXLogBuffer::GetReadLsn() {
     return read_lsn;
 }
 
+uint64_t
+MXLogBuffer::GetWriteLsn() {
+    uint64_t write_lsn;
+    BuildLsn(mxlog_buffer_writer_.file_no, mxlog_buffer_writer_.buf_offset, write_lsn);
+    return write_lsn;
+}
+
 bool
 MXLogBuffer::ResetWriteLsn(uint64_t lsn) {
     LOG_WAL_INFO_ << "reset write lsn " << lsn;
@@ -73,6 +73,9 @@ class MXLogBuffer {
     uint64_t
     GetReadLsn();
 
+    uint64_t
+    GetWriteLsn();
+
     bool
     ResetWriteLsn(uint64_t lsn);
 
@@ -494,6 +494,22 @@ WalManager::RemoveOldFiles(uint64_t flushed_lsn) {
     }
 }
 
+void
+WalManager::GetBufferStatus(milvus::json& status) {
+    if (p_buffer_ == nullptr) {
+        return;
+    }
+
+    uint32_t buffer_size = p_buffer_->GetBufferSize();
+    uint32_t buffer_used = buffer_size - p_buffer_->SurplusSpace();
+    status["buffer_size"] = buffer_size;
+    status["buffer_used"] = buffer_used;
+    status["fill_ratio"] = buffer_size > 0 ? (double)buffer_used / buffer_size : 0.0;
+    status["write_lsn"] = p_buffer_->GetWriteLsn();
+    status["read_lsn"] = p_buffer_->GetReadLsn();
+    status["last_applied_lsn"] = last_applied_lsn_.load();
+}
+
 template bool
 WalManager::Insert<float>(const std::string& collection_id, const std::string& partition_tag,
                           const IDNumbers& vector_ids, const std::vector<float>& vectors);
@@ -23,6 +23,7 @@
 #include "WalFileHandler.h"
 #include "WalMetaHandler.h"
 #include "utils/Error.h"
+#include "utils/Json.h"
 
 namespace milvus {
 namespace engine {
@@ -168,6 +169,13 @@ class WalManager {
         return last_applied_lsn_;
     }
 
+    /*
+     * Get buffer fill and the read/write positions
+     * @param status[out]: buffer status
+     */
+    void
+    GetBufferStatus(milvus::json& status);
+
  private:
     WalManager
     operator=(WalManager&);
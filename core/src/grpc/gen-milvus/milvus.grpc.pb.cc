@@ -61,6 +61,8 @@ static const char* MilvusService_method_names[] = {
   "/milvus.grpc.MilvusService/GetEntityByID",
   "/milvus.grpc.MilvusService/GetEntityIDs",
   "/milvus.grpc.MilvusService/DeleteEntitiesByID",
+  "/milvus.grpc.MilvusService/SearchStream",
+  "/milvus.grpc.MilvusService/SearchMulti",
 };
 
 std::unique_ptr< MilvusService::Stub> MilvusService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -111,6 +113,8 @@ MilvusService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   , rpcmethod_GetEntityByID_(MilvusService_method_names[38], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetEntityIDs_(MilvusService_method_names[39], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_DeleteEntitiesByID_(MilvusService_method_names[40], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SearchStream_(MilvusService_method_names[41], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_SearchMulti_(MilvusService_method_names[42], ::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
   {}
 
 ::grpc::Status MilvusService::Stub::CreateCollection(::grpc::ClientContext* context, const ::milvus::grpc::CollectionSchema& request, ::milvus::grpc::Status* response) {
@@ -1261,6 +1265,38 @@ void MilvusService::Stub::experimental_async::DeleteEntitiesByID(::grpc::ClientC
   return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::milvus::grpc::Status>::Create(channel_.get(), cq, rpcmethod_DeleteEntitiesByID_, context, request, false);
 }
 
+::grpc::ClientReader< ::milvus::grpc::TopKQueryResult>* MilvusService::Stub::SearchStreamRaw(::grpc::ClientContext* context, const ::milvus::grpc::SearchParam& request) {
+  return ::grpc_impl::internal::ClientReaderFactory< ::milvus::grpc::TopKQueryResult>::Create(channel_.get(), rpcmethod_SearchStream_, context, request);
+}
+
+void MilvusService::Stub::experimental_async::SearchStream(::grpc::ClientContext* context, ::milvus::grpc::SearchParam* request, ::grpc::experimental::ClientReadReactor< ::milvus::grpc::TopKQueryResult>* reactor) {
+  ::grpc_impl::internal::ClientCallbackReaderFactory< ::milvus::grpc::TopKQueryResult>::Create(stub_->channel_.get(), stub_->rpcmethod_SearchStream_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::milvus::grpc::TopKQueryResult>* MilvusService::Stub::AsyncSearchStreamRaw(::grpc::ClientContext* context, const ::milvus::grpc::SearchParam& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::milvus::grpc::TopKQueryResult>::Create(channel_.get(), cq, rpcmethod_SearchStream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::milvus::grpc::TopKQueryResult>* MilvusService::Stub::PrepareAsyncSearchStreamRaw(::grpc::ClientContext* context, const ::milvus::grpc::SearchParam& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::milvus::grpc::TopKQueryResult>::Create(channel_.get(), cq, rpcmethod_SearchStream_, context, request, false, nullptr);
+}
+
+::grpc::ClientReaderWriter< ::milvus::grpc::SearchParam, ::milvus::grpc::TopKQueryResult>* MilvusService::Stub::SearchMultiRaw(::grpc::ClientContext* context) {
+  return ::grpc_impl::internal::ClientReaderWriterFactory< ::milvus::grpc::SearchParam, ::milvus::grpc::TopKQueryResult>::Create(channel_.get(), rpcmethod_SearchMulti_, context);
+}
+
+void MilvusService::Stub::experimental_async::SearchMulti(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::milvus::grpc::SearchParam,::milvus::grpc::TopKQueryResult>* reactor) {
+  ::grpc_impl::internal::ClientCallbackReaderWriterFactory< ::milvus::grpc::SearchParam,::milvus::grpc::TopKQueryResult>::Create(stub_->channel_.get(), stub_->rpcmethod_SearchMulti_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::milvus::grpc::SearchParam, ::milvus::grpc::TopKQueryResult>* MilvusService::Stub::AsyncSearchMultiRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc_impl::internal::ClientAsyncReaderWriterFactory< ::milvus::grpc::SearchParam, ::milvus::grpc::TopKQueryResult>::Create(channel_.get(), cq, rpcmethod_SearchMulti_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::milvus::grpc::SearchParam, ::milvus::grpc::TopKQueryResult>* MilvusService::Stub::PrepareAsyncSearchMultiRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncReaderWriterFactory< ::milvus::grpc::SearchParam, ::milvus::grpc::TopKQueryResult>::Create(channel_.get(), cq, rpcmethod_SearchMulti_, context, false, nullptr);
+}
+
 MilvusService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       MilvusService_method_names[0],
@@ -1467,6 +1503,16 @@ MilvusService::Service::Service() {
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< MilvusService::Service, ::milvus::grpc::HDeleteByIDParam, ::milvus::grpc::Status>(
           std::mem_fn(&MilvusService::Service::DeleteEntitiesByID), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MilvusService_method_names[41],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< MilvusService::Service, ::milvus::grpc::SearchParam, ::milvus::grpc::TopKQueryResult>(
+          std::mem_fn(&MilvusService::Service::SearchStream), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MilvusService_method_names[42],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< MilvusService::Service, ::milvus::grpc::SearchParam, ::milvus::grpc::TopKQueryResult>(
+          std::mem_fn(&MilvusService::Service::SearchMulti), this)));
 }
 
 MilvusService::Service::~Service() {
@@ -1759,6 +1805,19 @@ MilvusService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status MilvusService::Service::SearchStream(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request, ::grpc::ServerWriter< ::milvus::grpc::TopKQueryResult>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MilvusService::Service::SearchMulti(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::milvus::grpc::TopKQueryResult, ::milvus::grpc::SearchParam>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace milvus
 }  // namespace grpc
@@ -1640,7 +1640,7 @@ const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "\017CompareOperator\022\006\n\002LT\020\000\022\007\n\003LTE\020\001\022\006\n\002EQ\020"
   "\002\022\006\n\002GT\020\003\022\007\n\003GTE\020\004\022\006\n\002NE\020\005*8\n\005Occur\022\013\n\007I"
   "NVALID\020\000\022\010\n\004MUST\020\001\022\n\n\006SHOULD\020\002\022\014\n\010MUST_N"
-  "OT\020\0032\370\027\n\rMilvusService\022H\n\020CreateCollecti"
+  "OT\020\0032\221\031\n\rMilvusService\022H\n\020CreateCollecti"
   "on\022\035.milvus.grpc.CollectionSchema\032\023.milv"
   "us.grpc.Status\"\000\022F\n\rHasCollection\022\033.milv"
   "us.grpc.CollectionName\032\026.milvus.grpc.Boo"
@@ -1716,7 +1716,11 @@ const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "J\n\014GetEntityIDs\022\037.milvus.grpc.HGetEntity"
   "IDsParam\032\027.milvus.grpc.HEntityIDs\"\000\022J\n\022D"
   "eleteEntitiesByID\022\035.milvus.grpc.HDeleteB"
-  "yIDParam\032\023.milvus.grpc.Status\"\000b\006proto3"
+  "yIDParam\032\023.milvus.grpc.Status\"\000\022J\n\014Searc"
+  "hStream\022\030.milvus.grpc.SearchParam\032\034.milv"
+  "us.grpc.TopKQueryResult\"\0000\001\022K\n\013SearchMul"
+  "ti\022\030.milvus.grpc.SearchParam\032\034.milvus.gr"
+  "pc.TopKQueryResult\"\000(\0010\001b\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_milvus_2eproto_deps[1] = {
   &::descriptor_table_status_2eproto,
@@ -1775,7 +1779,7 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_mil
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_milvus_2eproto_once;
 static bool descriptor_table_milvus_2eproto_initialized = false;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_milvus_2eproto = {
-  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 8599,
+  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 8752,
   &descriptor_table_milvus_2eproto_once, descriptor_table_milvus_2eproto_sccs, descriptor_table_milvus_2eproto_deps, 49, 1,
   schemas, file_default_instances, TableStruct_milvus_2eproto::offsets,
   file_level_metadata_milvus_2eproto, 50, file_level_enum_descriptors_milvus_2eproto, file_level_service_descriptors_milvus_2eproto,
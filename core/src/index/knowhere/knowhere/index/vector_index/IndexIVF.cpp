@@ -23,6 +23,7 @@
 #endif
 
 #include <fiu-local.h>
+#include <omp.h>
 #include <algorithm>
 #include <chrono>
 #include <memory>
@@ -47,6 +48,13 @@ namespace knowhere {
 
 using stdclock = std::chrono::high_resolution_clock;
 
+// at most this many queries always have their probed lists split across threads
+constexpr int64_t LIST_SPLIT_MAX_NQ = 4;
+
+// beyond LIST_SPLIT_MAX_NQ queries, segments with fewer rows are searched one query per thread, splitting their
+// lists is not worth the merge
+constexpr int64_t LIST_SPLIT_MIN_ROWS = 65536;
+
 BinarySet
 IVF::Serialize(const Config& config) {
     if (!index_ || !index_->is_trained) {
@@ -300,7 +308,11 @@ IVF::QueryImpl(int64_t n, const float* data, int64_t k, float* distances, int64_
     auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
     ivf_index->nprobe = std::min(params->nprobe, ivf_index->invlists->nlist);
     stdclock::time_point before = stdclock::now();
-    if (params->nprobe > 1 && n <= 4) {
+    // a few queries have their probed lists split across the threads, so does a large segment searched by fewer
+    // queries than threads, each thread keeps a partial top k and the partial results are merged per query
+    int64_t list_parallelism = std::min<int64_t>(ivf_index->nprobe, omp_get_max_threads());
+    bool large_segment = ivf_index->ntotal >= LIST_SPLIT_MIN_ROWS && list_parallelism > n;
+    if (ivf_index->nprobe > 1 && (n <= LIST_SPLIT_MAX_NQ || large_segment)) {
         ivf_index->parallel_mode = 1;
     } else {
         ivf_index->parallel_mode = 0;
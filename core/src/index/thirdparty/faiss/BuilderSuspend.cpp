@@ -11,24 +11,48 @@
 
 #include "BuilderSuspend.h"
 
+#include <chrono>
+
 namespace faiss {
 
 std::atomic<bool> BuilderSuspend::suspend_flag_(false);
 std::mutex BuilderSuspend::mutex_;
 std::condition_variable BuilderSuspend::cv_;
+std::atomic<int64_t> BuilderSuspend::run_until_(0);
+constexpr int64_t BuilderSuspend::MAX_WAIT_MS;
+constexpr int64_t BuilderSuspend::RUN_WINDOW_MS;
+
+namespace {
+
+int64_t now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
 
 void BuilderSuspend::suspend() {
     suspend_flag_ = true;
 }
 
 void BuilderSuspend::resume() {
-    suspend_flag_ = false;
+    {
+        std::lock_guard<std::mutex> lck(mutex_);
+        suspend_flag_ = false;
+    }
+    cv_.notify_all();
 }
 
 void BuilderSuspend::check_wait() {
-    while (suspend_flag_) {
-        std::unique_lock<std::mutex> lck(mutex_);
-        cv_.wait_for(lck, std::chrono::seconds(5));
+    if (!suspend_flag_ || now_ms() < run_until_) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lck(mutex_);
+    bool resumed = cv_.wait_for(lck, std::chrono::milliseconds(MAX_WAIT_MS), [] { return !suspend_flag_; });
+    if (!resumed) {
+        // starved, let the builders run for a while
+        run_until_ = now_ms() + RUN_WINDOW_MS;
     }
 }
 
@@ -13,6 +13,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 
 namespace faiss {
@@ -25,9 +26,14 @@ public:
 
 private:
     static std::atomic<bool> suspend_flag_;
+    static std::atomic<int64_t> run_until_;
     static std::mutex mutex_;
     static std::condition_variable cv_;
 
+    // a build suspended longer than MAX_WAIT_MS runs for RUN_WINDOW_MS before it waits again,
+    // so a steady search load slows index building down but never starves it
+    static constexpr int64_t MAX_WAIT_MS = 2000;
+    static constexpr int64_t RUN_WINDOW_MS = 200;
 };
 
 }  // namespace faiss
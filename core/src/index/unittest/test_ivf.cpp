@@ -13,6 +13,8 @@
 
 #include <fiu-control.h>
 #include <fiu-local.h>
+#include <omp.h>
+#include <algorithm>
 #include <iostream>
 #include <thread>
 
@@ -150,6 +152,54 @@ TEST_P(IVFTest, ivf_basic_cpu) {
 #endif
 }
 
+TEST_P(IVFTest, ivf_large_segment_cpu) {
+    if (index_mode_ != milvus::knowhere::IndexMode::MODE_CPU) {
+        return;
+    }
+
+    const int64_t large_nb = 70000;
+    const int64_t large_nq = 8;
+    const int64_t large_nprobe = 32;
+    Generate(DIM, large_nb, large_nq);
+    index_->Train(base_dataset, conf_);
+    index_->AddWithoutIds(base_dataset, conf_);
+    EXPECT_EQ(index_->Count(), large_nb);
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_->index_.get());
+    ASSERT_NE(ivf_index, nullptr);
+
+    // a few queries always split their probed lists across threads
+    auto few_dataset = milvus::knowhere::GenDataset(2, DIM, xq.data());
+    auto result = index_->Query(few_dataset, conf_, nullptr);
+    AssertAnns(result, 2, k);
+    ReleaseQueryResult(result);
+    EXPECT_EQ(ivf_index->parallel_mode, 1);
+
+    // more queries than probed lists are searched one query per thread
+    result = index_->Query(query_dataset, conf_, nullptr);
+    AssertAnns(result, nq, k);
+    ReleaseQueryResult(result);
+    EXPECT_EQ(ivf_index->parallel_mode, 0);
+
+    // a large segment splits the lists while there are more threads than queries
+    conf_[milvus::knowhere::IndexParams::nprobe] = large_nprobe;
+    result = index_->Query(query_dataset, conf_, nullptr);
+    AssertAnns(result, nq, k);
+    ReleaseQueryResult(result);
+    EXPECT_EQ(ivf_index->parallel_mode, std::min<int64_t>(large_nprobe, omp_get_max_threads()) > large_nq ? 1 : 0);
+
+    // a small segment keeps one query per thread
+    Generate(DIM, NB, large_nq);
+    index_ = IndexFactory(index_type_, index_mode_);
+    index_->Train(base_dataset, conf_);
+    index_->AddWithoutIds(base_dataset, conf_);
+    ivf_index = dynamic_cast<faiss::IndexIVF*>(index_->index_.get());
+    ASSERT_NE(ivf_index, nullptr);
+    result = index_->Query(query_dataset, conf_, nullptr);
+    AssertAnns(result, nq, k);
+    ReleaseQueryResult(result);
+    EXPECT_EQ(ivf_index->parallel_mode, 0);
+}
+
 TEST_P(IVFTest, ivf_basic_gpu) {
     assert(!xb.empty());
 
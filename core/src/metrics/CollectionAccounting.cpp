@@ -0,0 +1,192 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "metrics/CollectionAccounting.h"
+
+#include <algorithm>
+
+#include "config/Config.h"
+#include "metrics/Metrics.h"
+
+namespace milvus {
+namespace server {
+
+namespace {
+const char* OTHER_COLLECTIONS = "__other__";
+}  // namespace
+
+void
+CollectionAccounting::AddSearch(const std::string& collection, double total_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& usage = usages_[collection];
+    ++usage.search_count_;
+    usage.search_us_ += total_us;
+    // observed under the lock, so a collection leaving the top n can't have its series re-created after removal
+    Metrics::GetInstance().CollectionSearchDurationHistogramObserve(MetricLabel(collection), total_us);
+}
+
+void
+CollectionAccounting::AddSearchStages(const std::string& collection, const std::string& index_type,
+                                      const std::vector<std::pair<std::string, double>>& stages) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto label = MetricLabel(collection);
+    for (auto& pair : stages) {
+        Metrics::GetInstance().SearchStageDurationHistogramObserve(pair.first, label, index_type, pair.second);
+    }
+}
+
+void
+CollectionAccounting::AddSearchTask(const std::string& collection, uint64_t rows, double execute_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& usage = usages_[collection];
+    usage.rows_scanned_ += rows;
+    usage.search_execute_us_ += execute_us;
+}
+
+void
+CollectionAccounting::AddInsert(const std::string& collection, uint64_t rows, uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& usage = usages_[collection];
+    usage.insert_rows_ += rows;
+    usage.insert_bytes_ += bytes;
+}
+
+void
+CollectionAccounting::AddTaskTime(const std::string& collection, CollectionTaskType type, double microseconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& usage = usages_[collection];
+    switch (type) {
+        case CollectionTaskType::FLUSH:
+            usage.flush_us_ += microseconds;
+            break;
+        case CollectionTaskType::MERGE:
+            usage.merge_us_ += microseconds;
+            break;
+        case CollectionTaskType::BUILD_INDEX:
+            usage.build_index_us_ += microseconds;
+            break;
+    }
+}
+
+void
+CollectionAccounting::SetCacheBytes(const std::unordered_map<std::string, int64_t>& cache_bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& pair : usages_) {
+        pair.second.cache_bytes_ = 0;
+    }
+    for (auto& pair : cache_bytes) {
+        usages_[pair.first].cache_bytes_ = pair.second;
+    }
+}
+
+void
+CollectionAccounting::Remove(const std::string& collection) {
+    bool exported = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        usages_.erase(collection);
+        exported = exported_.erase(collection) > 0;
+    }
+    if (exported) {
+        Metrics::GetInstance().CollectionUsageRemove(collection);
+    }
+}
+
+std::vector<std::pair<std::string, CollectionUsage>>
+CollectionAccounting::TopN(int64_t n) {
+    std::vector<std::pair<std::string, CollectionUsage>> usages;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        usages.assign(usages_.begin(), usages_.end());
+    }
+
+    auto count = std::min(static_cast<size_t>(std::max(n, (int64_t)0)), usages.size());
+    std::partial_sort(usages.begin(), usages.begin() + count, usages.end(), [](const auto& left, const auto& right) {
+        if (left.second.Cost() != right.second.Cost()) {
+            return left.second.Cost() > right.second.Cost();
+        }
+        return left.second.search_count_ > right.second.search_count_;
+    });
+    usages.resize(count);
+    return usages;
+}
+
+milvus::json
+CollectionAccounting::Dump(int64_t n) {
+    milvus::json collections = milvus::json::array();
+    for (auto& pair : TopN(n)) {
+        auto& usage = pair.second;
+        milvus::json collection{
+            {"collection", pair.first},
+            {"search_count", usage.search_count_},
+            {"search_ms", usage.search_us_ / 1000},
+            {"rows_scanned", usage.rows_scanned_},
+            {"search_execute_ms", usage.search_execute_us_ / 1000},
+            {"cache_bytes", usage.cache_bytes_},
+            {"insert_rows", usage.insert_rows_},
+            {"insert_bytes", usage.insert_bytes_},
+            {"flush_ms", usage.flush_us_ / 1000},
+            {"merge_ms", usage.merge_us_ / 1000},
+            {"build_index_ms", usage.build_index_us_ / 1000},
+        };
+        collections.push_back(collection);
+    }
+
+    milvus::json ret;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ret["collection_count"] = usages_.size();
+    }
+    ret["collections"] = collections;
+    return ret;
+}
+
+void
+CollectionAccounting::Export() {
+    int64_t top_n = 0;
+    Config::GetInstance().GetMetricConfigCollectionTopN(top_n);
+
+    std::unordered_set<std::string> exported;
+    for (auto& pair : TopN(top_n)) {
+        exported.insert(pair.first);
+        Metrics::GetInstance().CollectionUsageSet(pair.first, pair.second);
+    }
+
+    std::vector<std::string> dropped;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& collection : exported_) {
+            if (exported.find(collection) == exported.end()) {
+                dropped.push_back(collection);
+            }
+        }
+        exported_.swap(exported);
+    }
+
+    // series of collections that fell out of the top n are removed, they restart from zero if they come back
+    for (auto& collection : dropped) {
+        Metrics::GetInstance().CollectionUsageRemove(collection);
+    }
+}
+
+std::string
+CollectionAccounting::Label(const std::string& collection) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return MetricLabel(collection);
+}
+
+std::string
+CollectionAccounting::MetricLabel(const std::string& collection) {
+    return exported_.find(collection) != exported_.end() ? collection : OTHER_COLLECTIONS;
+}
+
+}  // namespace server
+}  // namespace milvus
@@ -0,0 +1,120 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "utils/Json.h"
+
+namespace milvus {
+namespace server {
+
+enum class CollectionTaskType {
+    FLUSH,
+    MERGE,
+    BUILD_INDEX,
+};
+
+// Resources consumed by one collection since the server started. A search and its tasks are charged to the
+// searched collection, other work on a partition is accounted under the partition's own collection id.
+struct CollectionUsage {
+    uint64_t search_count_ = 0;
+    double search_us_ = 0;
+    uint64_t rows_scanned_ = 0;
+    double search_execute_us_ = 0;  // time XSearchTask::Execute held a search resource
+    int64_t cache_bytes_ = 0;
+    uint64_t insert_rows_ = 0;
+    uint64_t insert_bytes_ = 0;
+    double flush_us_ = 0;
+    double merge_us_ = 0;
+    double build_index_us_ = 0;
+
+    // time spent on the collection, used to rank collections
+    double
+    Cost() const {
+        return search_execute_us_ + flush_us_ + merge_us_ + build_index_us_;
+    }
+};
+
+// Per-collection resource accounting. Only the top metric.collection_top_n collections by cost get their own
+// metric series, so the cardinality stays bounded with many collections.
+class CollectionAccounting {
+ private:
+    CollectionAccounting() = default;
+
+ public:
+    static CollectionAccounting&
+    GetInstance() {
+        static CollectionAccounting instance;
+        return instance;
+    }
+
+    // a search request finished, total_us is measured from the time it was queued
+    void
+    AddSearch(const std::string& collection, double total_us);
+
+    // time of each stage of a search request, in microseconds
+    void
+    AddSearchStages(const std::string& collection, const std::string& index_type,
+                    const std::vector<std::pair<std::string, double>>& stages);
+
+    void
+    AddSearchTask(const std::string& collection, uint64_t rows, double execute_us);
+
+    void
+    AddInsert(const std::string& collection, uint64_t rows, uint64_t bytes);
+
+    void
+    AddTaskTime(const std::string& collection, CollectionTaskType type, double microseconds);
+
+    // bytes held in cpu cache by each collection, collections not listed hold nothing
+    void
+    SetCacheBytes(const std::unordered_map<std::string, int64_t>& cache_bytes);
+
+    // the collection is dropped
+    void
+    Remove(const std::string& collection);
+
+    // the n collections with the highest cost, highest first
+    std::vector<std::pair<std::string, CollectionUsage>>
+    TopN(int64_t n);
+
+    milvus::json
+    Dump(int64_t n);
+
+    // recompute the top n and export their usage, called by the background metric task
+    void
+    Export();
+
+    // metric label of the collection, collections outside the exported top n share one label
+    std::string
+    Label(const std::string& collection);
+
+ private:
+    // collections outside the exported top n share one label in latency histograms
+    std::string
+    MetricLabel(const std::string& collection);
+
+ private:
+    std::mutex mutex_;
+    std::unordered_map<std::string, CollectionUsage> usages_;
+    std::unordered_set<std::string> exported_;
+};
+
+}  // namespace server
+}  // namespace milvus
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "SystemInfo.h"
+#include "metrics/CollectionAccounting.h"
 #include "utils/Status.h"
 
 #include <string>
@@ -199,6 +200,87 @@ class MetricsBase {
     CPUTemperature() {
     }
 
+    virtual void
+    RequestQueueWaitDurationHistogramObserve(double value) {
+    }
+
+    virtual void
+    RequestExpiredTotalIncrement(double value = 1) {
+    }
+
+    virtual void
+    SearchCanceledTotalIncrement(double value = 1) {
+    }
+
+    virtual void
+    SearchCombinedTotalIncrement(double value = 1) {
+    }
+
+    virtual void
+    SearchNotCombinedTotalIncrement(double value = 1) {
+    }
+
+    virtual void
+    SearchCombineBatchSizeHistogramObserve(double value) {
+    }
+
+    virtual void
+    QueryCacheHitTotalIncrement(double value = 1) {
+    }
+
+    virtual void
+    QueryCacheMissTotalIncrement(double value = 1) {
+    }
+
+    virtual void
+    MetaCacheHitTotalIncrement(double value = 1) {
+    }
+
+    virtual void
+    MetaCacheMissTotalIncrement(double value = 1) {
+    }
+
+    virtual void
+    SearchStageDurationHistogramObserve(const std::string& stage, const std::string& collection,
+                                        const std::string& index_type, double value) {
+    }
+
+    virtual void
+    JobPlanDurationHistogramObserve(const std::string& job_type, double value) {
+    }
+
+    virtual void
+    TaskTableStateGaugeSet(const std::string& resource, const std::string& state, double value) {
+    }
+
+    virtual void
+    BuildIndexSlotsGaugeSet(double in_use, double available) {
+    }
+
+    virtual void
+    CpuCacheStatsSet(double items, double hits, double misses, double evictions) {
+    }
+
+    virtual void
+    WalBufferGaugeSet(double used, double capacity) {
+    }
+
+    virtual void
+    CollectionSearchDurationHistogramObserve(const std::string& collection, double value) {
+    }
+
+    virtual void
+    CollectionUsageSet(const std::string& collection, const CollectionUsage& usage) {
+    }
+
+    virtual void
+    CollectionUsageRemove(const std::string& collection) {
+    }
+
+    virtual void
+    SearchRecallHistogramObserve(const std::string& collection, const std::string& index_type, double value) {
+    }
+
     virtual void
     PushToGateway() {
     }
@@ -13,6 +13,9 @@
 
 #include "MetricBase.h"
 #include "db/meta/MetaTypes.h"
+#include "metrics/CollectionAccounting.h"
+
+#include <string>
 
 namespace milvus {
 namespace server {
@@ -233,6 +236,23 @@ class CollectSearchTaskMetrics : CollectMetricsBase {
     int index_type_;
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class CollectCollectionTaskMetrics : CollectMetricsBase {
+ public:
+    CollectCollectionTaskMetrics(const std::string& collection, CollectionTaskType type)
+        : collection_(collection), type_(type) {
+    }
+
+    ~CollectCollectionTaskMetrics() {
+        auto total_time = TimeFromBegine();
+        CollectionAccounting::GetInstance().AddTaskTime(collection_, type_, total_time);
+    }
+
+ private:
+    std::string collection_;
+    CollectionTaskType type_;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class MetricCollector : CollectMetricsBase {
  public:
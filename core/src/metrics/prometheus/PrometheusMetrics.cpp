@@ -16,12 +16,23 @@
 #include "utils/Log.h"
 
 #include <unistd.h>
+#include <map>
 #include <string>
 #include <utility>
 
 namespace milvus {
 namespace server {
 
+namespace {
+// counters follow cumulative values kept elsewhere, push only what is new since the last call
+void
+CatchUp(prometheus::Counter& counter, double value) {
+    if (value > counter.Value()) {
+        counter.Increment(value - counter.Value());
+    }
+}
+}  // namespace
+
 Status
 PrometheusMetrics::Init() {
     try {
@@ -200,6 +211,87 @@ PrometheusMetrics::OctetsSet() {
     }
 }
 
+void
+PrometheusMetrics::CpuCacheStatsSet(double items, double hits, double misses, double evictions) {
+    if (!startup_) {
+        return;
+    }
+
+    cpu_cache_items_gauge_.Set(items);
+    CatchUp(cpu_cache_hit_total_, hits);
+    CatchUp(cpu_cache_miss_total_, misses);
+    CatchUp(cpu_cache_evict_total_, evictions);
+}
+
+void
+PrometheusMetrics::SearchStageDurationHistogramObserve(const std::string& stage, const std::string& collection,
+                                                       const std::string& index_type, double value) {
+    if (!startup_) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(search_stage_mutex_);
+        search_stage_labels_[collection].emplace(stage, index_type);
+    }
+    search_stage_duration_
+        .Add({{"stage", stage}, {"collection", collection}, {"index_type", index_type}}, search_stage_buckets_)
+        .Observe(value);
+}
+
+void
+PrometheusMetrics::CollectionUsageSet(const std::string& collection, const CollectionUsage& usage) {
+    if (!startup_) {
+        return;
+    }
+
+    CatchUp(collection_search_.Add({{"collection", collection}}), usage.search_count_);
+    CatchUp(collection_rows_scanned_.Add({{"collection", collection}}), usage.rows_scanned_);
+    CatchUp(collection_search_execute_.Add({{"collection", collection}}), usage.search_execute_us_);
+    collection_cache_.Add({{"collection", collection}}).Set(usage.cache_bytes_);
+    CatchUp(collection_insert_.Add({{"collection", collection}, {"unit", "rows"}}), usage.insert_rows_);
+    CatchUp(collection_insert_.Add({{"collection", collection}, {"unit", "bytes"}}), usage.insert_bytes_);
+    CatchUp(collection_task_.Add({{"collection", collection}, {"task", "flush"}}), usage.flush_us_);
+    CatchUp(collection_task_.Add({{"collection", collection}, {"task", "merge"}}), usage.merge_us_);
+    CatchUp(collection_task_.Add({{"collection", collection}, {"task", "build_index"}}), usage.build_index_us_);
+}
+
+void
+PrometheusMetrics::CollectionUsageRemove(const std::string& collection) {
+    if (!startup_) {
+        return;
+    }
+
+    auto remove = [&](auto& family, const std::map<std::string, std::string>& labels) {
+        family.Remove(&family.Add(labels));
+    };
+    collection_search_duration_.Remove(
+        &collection_search_duration_.Add({{"collection", collection}}, collection_search_buckets_));
+    remove(collection_search_, {{"collection", collection}});
+    remove(collection_rows_scanned_, {{"collection", collection}});
+    remove(collection_search_execute_, {{"collection", collection}});
+    remove(collection_cache_, {{"collection", collection}});
+    remove(collection_insert_, {{"collection", collection}, {"unit", "rows"}});
+    remove(collection_insert_, {{"collection", collection}, {"unit", "bytes"}});
+    for (auto task : {"flush", "merge", "build_index"}) {
+        remove(collection_task_, {{"collection", collection}, {"task", task}});
+    }
+
+    std::set<std::pair<std::string, std::string>> stage_labels;
+    {
+        std::lock_guard<std::mutex> lock(search_stage_mutex_);
+        auto iter = search_stage_labels_.find(collection);
+        if (iter != search_stage_labels_.end()) {
+            stage_labels.swap(iter->second);
+            search_stage_labels_.erase(iter);
+        }
+    }
+    for (auto& pair : stage_labels) {
+        search_stage_duration_.Remove(&search_stage_duration_.Add(
+            {{"stage", pair.first}, {"collection", collection}, {"index_type", pair.second}}, search_stage_buckets_));
+    }
+}
+
 void
 PrometheusMetrics::CPUCoreUsagePercentSet() {
     if (!startup_) {
@@ -16,7 +16,11 @@
 #include <prometheus/registry.h>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "metrics/MetricBase.h"
@@ -289,6 +293,135 @@ class PrometheusMetrics : public MetricsBase {
     void
     CPUTemperature() override;
 
+    void
+    RequestQueueWaitDurationHistogramObserve(double value) override {
+        if (startup_) {
+            request_queue_wait_duration_histogram_.Observe(value);
+        }
+    }
+
+    void
+    RequestExpiredTotalIncrement(double value = 1) override {
+        if (startup_) {
+            request_expired_total_.Increment(value);
+        }
+    }
+
+    void
+    SearchCanceledTotalIncrement(double value = 1) override {
+        if (startup_) {
+            search_canceled_total_.Increment(value);
+        }
+    }
+
+    void
+    SearchCombinedTotalIncrement(double value = 1) override {
+        if (startup_) {
+            search_combined_total_.Increment(value);
+        }
+    }
+
+    void
+    SearchNotCombinedTotalIncrement(double value = 1) override {
+        if (startup_) {
+            search_not_combined_total_.Increment(value);
+        }
+    }
+
+    void
+    SearchCombineBatchSizeHistogramObserve(double value) override {
+        if (startup_) {
+            search_combine_batch_size_histogram_.Observe(value);
+        }
+    }
+
+    void
+    QueryCacheHitTotalIncrement(double value = 1) override {
+        if (startup_) {
+            query_cache_hit_total_.Increment(value);
+        }
+    }
+
+    void
+    QueryCacheMissTotalIncrement(double value = 1) override {
+        if (startup_) {
+            query_cache_miss_total_.Increment(value);
+        }
+    }
+
+    void
+    MetaCacheHitTotalIncrement(double value = 1) override {
+        if (startup_) {
+            meta_cache_hit_total_.Increment(value);
+        }
+    }
+
+    void
+    MetaCacheMissTotalIncrement(double value = 1) override {
+        if (startup_) {
+            meta_cache_miss_total_.Increment(value);
+        }
+    }
+
+    void
+    SearchStageDurationHistogramObserve(const std::string& stage, const std::string& collection,
+                                        const std::string& index_type, double value) override;
+
+    void
+    JobPlanDurationHistogramObserve(const std::string& job_type, double value) override {
+        if (startup_) {
+            job_plan_duration_.Add({{"job_type", job_type}}, search_stage_buckets_).Observe(value);
+        }
+    }
+
+    void
+    TaskTableStateGaugeSet(const std::string& resource, const std::string& state, double value) override {
+        if (startup_) {
+            task_table_tasks_.Add({{"resource", resource}, {"state", state}}).Set(value);
+        }
+    }
+
+    void
+    BuildIndexSlotsGaugeSet(double in_use, double available) override {
+        if (startup_) {
+            build_index_slots_in_use_gauge_.Set(in_use);
+            build_index_slots_available_gauge_.Set(available);
+        }
+    }
+
+    void
+    CpuCacheStatsSet(double items, double hits, double misses, double evictions) override;
+
+    void
+    WalBufferGaugeSet(double used, double capacity) override {
+        if (startup_) {
+            wal_buffer_used_gauge_.Set(used);
+            wal_buffer_capacity_gauge_.Set(capacity);
+        }
+    }
+
+    void
+    CollectionSearchDurationHistogramObserve(const std::string& collection, double value) override {
+        if (startup_) {
+            collection_search_duration_.Add({{"collection", collection}}, collection_search_buckets_).Observe(value);
+        }
+    }
+
+    void
+    CollectionUsageSet(const std::string& collection, const CollectionUsage& usage) override;
+
+    void
+    CollectionUsageRemove(const std::string& collection) override;
+
+    void
+    SearchRecallHistogramObserve(const std::string& collection, const std::string& index_type,
+                                 double value) override {
+        if (startup_) {
+            search_recall_.Add({{"collection", collection}, {"index_type", index_type}}, search_recall_buckets_)
+                .Observe(value);
+        }
+    }
+
     void
     PushToGateway() override {
         if (startup_) {
@@ -654,6 +787,153 @@ class PrometheusMetrics : public MetricsBase {
 
     prometheus::Family<prometheus::Gauge>& CPU_temperature_ =
         prometheus::BuildGauge().Name("CPU_temperature").Help("CPU temperature").Register(*registry_);
+
+    // record time that requests spend in the request queue before execution
+    prometheus::Family<prometheus::Histogram>& request_queue_wait_duration_ =
+        prometheus::BuildHistogram()
+            .Name("request_queue_wait_duration_microseconds")
+            .Help("histogram of time requests wait in the request queue")
+            .Register(*registry_);
+    prometheus::Histogram& request_queue_wait_duration_histogram_ =
+        request_queue_wait_duration_.Add({}, BucketBoundaries{1e3, 1e4, 1e5, 5e5, 1e6, 5e6, 1e7});
+
+    // record requests dropped because the client deadline was exceeded
+    prometheus::Family<prometheus::Counter>& request_shed_ = prometheus::BuildCounter()
+                                                                 .Name("request_shed_total")
+                                                                 .Help("the number of requests dropped after deadline")
+                                                                 .Register(*registry_);
+    prometheus::Counter& request_expired_total_ = request_shed_.Add({{"stage", "queue"}});
+    prometheus::Counter& search_canceled_total_ = request_shed_.Add({{"stage", "search"}});
+
+    // record whether queued search requests are combined
+    prometheus::Family<prometheus::Counter>& search_combine_ = prometheus::BuildCounter()
+                                                                   .Name("search_combine_total")
+                                                                   .Help("search request combine decisions")
+                                                                   .Register(*registry_);
+    prometheus::Counter& search_combined_total_ = search_combine_.Add({{"decision", "combined"}});
+    prometheus::Counter& search_not_combined_total_ = search_combine_.Add({{"decision", "not_combined"}});
+
+    prometheus::Family<prometheus::Histogram>& search_combine_batch_size_ =
+        prometheus::BuildHistogram()
+            .Name("search_combine_batch_size")
+            .Help("histogram of request count executed by each combined search")
+            .Register(*registry_);
+    prometheus::Histogram& search_combine_batch_size_histogram_ =
+        search_combine_batch_size_.Add({}, BucketBoundaries{2, 4, 8, 16, 32, 64});
+
+    // record query result cache lookups
+    prometheus::Family<prometheus::Counter>& query_cache_ = prometheus::BuildCounter()
+                                                                .Name("query_cache_total")
+                                                                .Help("query result cache lookups")
+                                                                .Register(*registry_);
+    prometheus::Counter& query_cache_hit_total_ = query_cache_.Add({{"result", "hit"}});
+    prometheus::Counter& query_cache_miss_total_ = query_cache_.Add({{"result", "miss"}});
+
+    // record meta read cache lookups
+    prometheus::Family<prometheus::Counter>& meta_cache_ = prometheus::BuildCounter()
+                                                               .Name("meta_cache_total")
+                                                               .Help("meta read cache lookups")
+                                                               .Register(*registry_);
+    prometheus::Counter& meta_cache_hit_total_ = meta_cache_.Add({{"result", "hit"}});
+    prometheus::Counter& meta_cache_miss_total_ = meta_cache_.Add({{"result", "miss"}});
+
+    // record time of each search stage, labeled by stage, collection (top n only, the rest share __other__) and
+    // index type
+    prometheus::Family<prometheus::Histogram>& search_stage_duration_ =
+        prometheus::BuildHistogram()
+            .Name("search_stage_duration_microseconds")
+            .Help("histogram of time search requests spend in each stage")
+            .Register(*registry_);
+    const BucketBoundaries search_stage_buckets_ = {1e2, 1e3, 1e4, 1e5, 5e5, 1e6, 5e6};
+    // stage and index type labels observed for each collection, their series are removed with the collection
+    std::mutex search_stage_mutex_;
+    std::unordered_map<std::string, std::set<std::pair<std::string, std::string>>> search_stage_labels_;
+
+    // record time the job manager spends turning a job into scheduled tasks
+    prometheus::Family<prometheus::Histogram>& job_plan_duration_ =
+        prometheus::BuildHistogram()
+            .Name("scheduler_job_plan_duration_microseconds")
+            .Help("histogram of time spent building, optimizing and routing the tasks of a job")
+            .Register(*registry_);
+
+    // record tasks held by each resource task table, labeled by resource and task state
+    prometheus::Family<prometheus::Gauge>& task_table_tasks_ = prometheus::BuildGauge()
+                                                                   .Name("scheduler_task_table_tasks")
+                                                                   .Help("number of tasks in each task table state")
+                                                                   .Register(*registry_);
+
+    prometheus::Family<prometheus::Gauge>& build_index_slots_ = prometheus::BuildGauge()
+                                                                    .Name("build_index_slots")
+                                                                    .Help("concurrent index build slots")
+                                                                    .Register(*registry_);
+    prometheus::Gauge& build_index_slots_in_use_gauge_ = build_index_slots_.Add({{"state", "in_use"}});
+    prometheus::Gauge& build_index_slots_available_gauge_ = build_index_slots_.Add({{"state", "available"}});
+
+    // record cpu cache item count and lookups, counters follow the cumulative values kept by the cache
+    prometheus::Family<prometheus::Gauge>& cpu_cache_items_ =
+        prometheus::BuildGauge().Name("cpu_cache_items").Help("number of items in cpu cache").Register(*registry_);
+    prometheus::Gauge& cpu_cache_items_gauge_ = cpu_cache_items_.Add({});
+
+    prometheus::Family<prometheus::Counter>& cpu_cache_lookup_ = prometheus::BuildCounter()
+                                                                     .Name("cpu_cache_lookup_total")
+                                                                     .Help("cpu cache lookups and evictions")
+                                                                     .Register(*registry_);
+    prometheus::Counter& cpu_cache_hit_total_ = cpu_cache_lookup_.Add({{"result", "hit"}});
+    prometheus::Counter& cpu_cache_miss_total_ = cpu_cache_lookup_.Add({{"result", "miss"}});
+    prometheus::Counter& cpu_cache_evict_total_ = cpu_cache_lookup_.Add({{"result", "evict"}});
+
+    prometheus::Family<prometheus::Gauge>& wal_buffer_ =
+        prometheus::BuildGauge().Name("wal_buffer_bytes").Help("wal write buffer usage").Register(*registry_);
+    prometheus::Gauge& wal_buffer_used_gauge_ = wal_buffer_.Add({{"type", "used"}});
+    prometheus::Gauge& wal_buffer_capacity_gauge_ = wal_buffer_.Add({{"type", "capacity"}});
+
+    // record resources used by the top metric.collection_top_n collections, labeled by collection
+    prometheus::Family<prometheus::Histogram>& collection_search_duration_ =
+        prometheus::BuildHistogram()
+            .Name("collection_search_duration_microseconds")
+            .Help("histogram of search latency of each collection")
+            .Register(*registry_);
+    const BucketBoundaries collection_search_buckets_ = {1e3, 1e4, 5e4, 1e5, 5e5, 1e6, 5e6};
+
+    prometheus::Family<prometheus::Counter>& collection_search_ = prometheus::BuildCounter()
+                                                                      .Name("collection_search_total")
+                                                                      .Help("search requests of each collection")
+                                                                      .Register(*registry_);
+
+    prometheus::Family<prometheus::Counter>& collection_rows_scanned_ = prometheus::BuildCounter()
+                                                                            .Name("collection_rows_scanned_total")
+                                                                            .Help("rows scanned by search tasks")
+                                                                            .Register(*registry_);
+
+    prometheus::Family<prometheus::Counter>& collection_search_execute_ =
+        prometheus::BuildCounter()
+            .Name("collection_search_execute_microseconds_total")
+            .Help("time search tasks of each collection spent executing")
+            .Register(*registry_);
+
+    prometheus::Family<prometheus::Gauge>& collection_cache_ = prometheus::BuildGauge()
+                                                                   .Name("collection_cache_bytes")
+                                                                   .Help("cpu cache bytes held by each collection")
+                                                                   .Register(*registry_);
+
+    prometheus::Family<prometheus::Counter>& collection_insert_ = prometheus::BuildCounter()
+                                                                      .Name("collection_insert_total")
+                                                                      .Help("rows and bytes inserted")
+                                                                      .Register(*registry_);
+
+    prometheus::Family<prometheus::Counter>& collection_task_ =
+        prometheus::BuildCounter()
+            .Name("collection_task_microseconds_total")
+            .Help("time spent flushing, merging and building index of each collection")
+            .Register(*registry_);
+
+    // record recall@k of sampled searches measured against exact brute force
+    prometheus::Family<prometheus::Histogram>& search_recall_ =
+        prometheus::BuildHistogram()
+            .Name("search_recall")
+            .Help("histogram of recall of sampled searches, labeled by collection and index type")
+            .Register(*registry_);
+    const BucketBoundaries search_recall_buckets_ = {0.5, 0.7, 0.8, 0.9, 0.95, 0.99, 1.0};
 };
 
 }  // namespace server
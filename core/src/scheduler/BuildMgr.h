@@ -28,7 +28,7 @@ namespace scheduler {
 
 class BuildMgr {
  public:
-    explicit BuildMgr(int64_t concurrent_limit) : available_(concurrent_limit) {
+    explicit BuildMgr(int64_t concurrent_limit) : concurrent_limit_(concurrent_limit), available_(concurrent_limit) {
     }
 
  public:
@@ -54,7 +54,13 @@ class BuildMgr {
         return available_;
     }
 
+    int64_t
+    NumOfSlots() const {
+        return concurrent_limit_;
+    }
+
  private:
+    const std::int64_t concurrent_limit_;
     std::int64_t available_;
     std::mutex mutex_;
 };
@@ -14,11 +14,14 @@
 #include "src/db/Utils.h"
 #include "src/segment/SegmentReader.h"
 
+#include <algorithm>
+#include <chrono>
 #include <limits>
 #include <utility>
 
 #include "SchedInst.h"
 #include "TaskCreator.h"
+#include "metrics/Metrics.h"
 #include "scheduler/Algorithm.h"
 #include "scheduler/CPUBuilder.h"
 #include "scheduler/tasklabel/SpecResLabel.h"
@@ -28,7 +31,25 @@
 namespace milvus {
 namespace scheduler {
 
-JobMgr::JobMgr(ResourceMgrPtr res_mgr) : res_mgr_(std::move(res_mgr)) {
+namespace {
+constexpr uint64_t PRUNE_THREAD_COUNT = 8;
+
+std::string
+JobTypeName(JobType type) {
+    switch (type) {
+        case JobType::SEARCH:
+            return "search";
+        case JobType::DELETE:
+            return "delete";
+        case JobType::BUILD:
+            return "build";
+        default:
+            return "invalid";
+    }
+}
+}  // namespace
+
+JobMgr::JobMgr(ResourceMgrPtr res_mgr) : res_mgr_(std::move(res_mgr)), prune_thread_pool_(PRUNE_THREAD_COUNT) {
 }
 
 void
@@ -53,6 +74,8 @@ JobMgr::Dump() const {
     json ret{
         {"running", running_},
         {"event_queue_length", queue_.size()},
+        {"planned_job_count", planned_job_count_.load()},
+        {"plan_duration_us", plan_duration_us_.load()},
     };
     return ret;
 }
@@ -79,9 +102,9 @@ JobMgr::worker_function() {
             break;
         }
 
+        auto plan_start = std::chrono::steady_clock::now();
         auto tasks = build_task(job);
 
-        // TODO(zhiru): if the job is search by ids, pass any task where the ids don't exist
         auto search_job = std::dynamic_pointer_cast<SearchJob>(job);
         if (search_job != nullptr) {
             search_job->GetResultIds().resize(search_job->nq(), -1);
@@ -89,34 +112,7 @@ JobMgr::worker_function() {
 
             if (search_job->vectors().float_data_.empty() && search_job->vectors().binary_data_.empty() &&
                 !search_job->vectors().id_array_.empty()) {
-                for (auto task = tasks.begin(); task != tasks.end();) {
-                    auto search_task = std::static_pointer_cast<XSearchTask>(*task);
-                    auto location = search_task->GetLocation();
-
-                    // Load bloom filter
-                    std::string segment_dir;
-                    engine::utils::GetParentPath(location, segment_dir);
-                    segment::SegmentReader segment_reader(segment_dir);
-                    segment::IdBloomFilterPtr id_bloom_filter_ptr;
-                    segment_reader.LoadBloomFilter(id_bloom_filter_ptr, false);
-
-                    // Check if the id is present.
-                    bool pass = true;
-                    for (auto& id : search_job->vectors().id_array_) {
-                        if (id_bloom_filter_ptr->Check(id)) {
-                            pass = false;
-                            break;
-                        }
-                    }
-
-                    if (pass) {
-                        //                        std::cout << search_task->GetIndexId() << std::endl;
-                        search_job->SearchDone(search_task->GetIndexId());
-                        task = tasks.erase(task);
-                    } else {
-                        task++;
-                    }
-                }
+                prune_task(job, tasks);
             }
         }
 
@@ -126,13 +122,24 @@ JobMgr::worker_function() {
         //            tasks.erase(task);
         //        }
 
+        auto job_context = search_job != nullptr ? search_job->GetContext() : nullptr;
+        server::ContextStage optimize_stage(job_context, server::SearchStage::OPTIMIZE);
+        server::ContextChild optimize_tracer(job_context, "Optimizer passes");
+        optimize_tracer.SetTag("task_count", static_cast<uint64_t>(tasks.size()));
         for (auto& task : tasks) {
             OptimizerInst::GetInstance()->Run(task);
         }
+        optimize_tracer.Finish();
 
+        // the tasks of a job mostly share a few destinations, so each shortest path is computed once per job
+        server::ContextChild path_tracer(job_context, "Calculate path");
+        std::unordered_map<std::string, std::vector<std::string>> path_cache;
         for (auto& task : tasks) {
-            calculate_path(res_mgr_, task);
+            calculate_path(res_mgr_, task, path_cache);
         }
+        path_tracer.SetTag("path_count", static_cast<uint64_t>(path_cache.size()));
+        path_tracer.Finish();
+        optimize_stage.Finish();
 
         // disk resources NEVER be empty.
         if (auto disk = res_mgr_->GetDiskResources()[0].lock()) {
@@ -145,7 +152,47 @@ JobMgr::worker_function() {
                 }
             }
         }
+
+        auto plan_time = std::chrono::steady_clock::now() - plan_start;
+        auto plan_us = std::chrono::duration_cast<std::chrono::microseconds>(plan_time).count();
+        ++planned_job_count_;
+        plan_duration_us_ += plan_us;
+        server::Metrics::GetInstance().JobPlanDurationHistogramObserve(JobTypeName(job->type()), plan_us);
+    }
+}
+
+void
+JobMgr::prune_task(const JobPtr& job, std::vector<TaskPtr>& tasks) {
+    auto search_job = std::static_pointer_cast<SearchJob>(job);
+    auto& id_array = search_job->vectors().id_array_;
+
+    // the bloom filters are loaded and probed in parallel instead of one by one on the jobmgr thread
+    std::vector<std::future<bool>> probes;
+    probes.reserve(tasks.size());
+    for (auto& task : tasks) {
+        auto location = std::static_pointer_cast<XSearchTask>(task)->GetLocation();
+        probes.emplace_back(prune_thread_pool_.enqueue([location, &id_array]() {
+            std::string segment_dir;
+            engine::utils::GetParentPath(location, segment_dir);
+            segment::SegmentReader segment_reader(segment_dir);
+            segment::IdBloomFilterPtr id_bloom_filter_ptr;
+            if (!segment_reader.LoadBloomFilter(id_bloom_filter_ptr, false).ok()) {
+                return true;  // keep the task, the search tells
+            }
+            return std::any_of(id_array.begin(), id_array.end(),
+                               [&](const segment::doc_id_t& id) { return id_bloom_filter_ptr->Check(id); });
+        }));
+    }
+
+    std::vector<TaskPtr> hit_tasks;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (probes[i].get()) {
+            hit_tasks.emplace_back(tasks[i]);
+        } else {
+            search_job->SearchDone(std::static_pointer_cast<XSearchTask>(tasks[i])->GetIndexId());
+        }
     }
+    tasks.swap(hit_tasks);
 }
 
 std::vector<TaskPtr>
@@ -171,5 +218,32 @@ JobMgr::calculate_path(const ResourceMgrPtr& res_mgr, const TaskPtr& task) {
     task->path() = Path(path, path.size() - 1);
 }
 
+void
+JobMgr::calculate_path(const ResourceMgrPtr& res_mgr, const TaskPtr& task,
+                       std::unordered_map<std::string, std::vector<std::string>>& path_cache) {
+    if (task->type_ != TaskType::SearchTask && task->type_ != TaskType::BuildIndexTask) {
+        return;
+    }
+
+    if (task->label()->Type() != TaskLabelType::SPECIFIED_RESOURCE) {
+        return;
+    }
+
+    auto dest = std::static_pointer_cast<SpecResLabel>(task->label())->resource().lock();
+    if (dest == nullptr) {
+        calculate_path(res_mgr, task);
+        return;
+    }
+
+    auto iter = path_cache.find(dest->name());
+    if (iter == path_cache.end()) {
+        std::vector<std::string> path;
+        auto src = res_mgr->GetDiskResources()[0];
+        ShortestPath(src.lock(), dest, res_mgr, path);
+        iter = path_cache.emplace(dest->name(), std::move(path)).first;
+    }
+    task->path() = Path(iter->second, iter->second.size() - 1);
+}
+
 }  // namespace scheduler
 }  // namespace milvus
@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <list>
@@ -25,6 +26,7 @@
 #include "interface/interfaces.h"
 #include "job/Job.h"
 #include "task/Task.h"
+#include "utils/ThreadPool.h"
 
 namespace milvus {
 namespace scheduler {
@@ -53,20 +55,34 @@ class JobMgr : public interface::dumpable {
     static std::vector<TaskPtr>
     build_task(const JobPtr& job);
 
+    // drop the search by id tasks of segments whose bloom filter holds none of the ids
+    void
+    prune_task(const JobPtr& job, std::vector<TaskPtr>& tasks);
+
  public:
     static void
     calculate_path(const ResourceMgrPtr& res_mgr, const TaskPtr& task);
 
+    // as above, reusing the paths already computed for the same destination resource
+    static void
+    calculate_path(const ResourceMgrPtr& res_mgr, const TaskPtr& task,
+                   std::unordered_map<std::string, std::vector<std::string>>& path_cache);
+
  private:
     bool running_ = false;
     std::queue<JobPtr> queue_;
 
+    std::atomic<uint64_t> planned_job_count_{0};
+    std::atomic<uint64_t> plan_duration_us_{0};
+
     std::thread worker_thread_;
 
     std::mutex mutex_;
     std::condition_variable cv_;
 
     ResourceMgrPtr res_mgr_ = nullptr;
+
+    ThreadPool prune_thread_pool_;
 };
 
 using JobMgrPtr = std::shared_ptr<JobMgr>;
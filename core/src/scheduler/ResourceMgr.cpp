@@ -13,6 +13,8 @@
 #include "scheduler/ResourceMgr.h"
 #include "utils/Log.h"
 
+#include <map>
+
 namespace milvus {
 namespace scheduler {
 
@@ -196,6 +198,76 @@ ResourceMgr::DumpTaskTables() {
     return ss.str();
 }
 
+json
+ResourceMgr::DumpTaskTableStates() {
+    json ret = json::array();
+    std::lock_guard<std::mutex> lck(resources_mutex_);
+    for (auto& resource : resources_) {
+        auto table = resource->task_table().Dump();
+        table["name"] = resource->name();
+        table["task_to_execute"] = resource->NumOfTaskToExec();
+        ret.push_back(table);
+    }
+    return ret;
+}
+
+json
+ResourceMgr::DumpJobProgress() {
+    struct JobProgress {
+        JobType type = JobType::INVALID;
+        uint64_t total = 0;
+        uint64_t executed = 0;
+        std::map<std::string, uint64_t> states;
+        std::map<std::string, uint64_t> resources;
+    };
+    std::map<JobId, JobProgress> jobs;
+
+    {
+        std::lock_guard<std::mutex> lck(resources_mutex_);
+        for (auto& resource : resources_) {
+            auto& table = resource->task_table();
+            for (size_t i = 0; i < table.size(); ++i) {
+                auto& item = table.at(i);
+                // a moved task is tracked again by the table it moved to
+                if (item == nullptr || item->state == TaskTableItemState::MOVED) {
+                    continue;
+                }
+                auto task = item->get_task();
+                auto job = task != nullptr ? task->job_.lock() : nullptr;
+                if (job == nullptr) {
+                    continue;
+                }
+
+                auto& progress = jobs[job->id()];
+                progress.type = job->type();
+                ++progress.total;
+                if (item->state == TaskTableItemState::EXECUTED) {
+                    ++progress.executed;
+                } else {
+                    ++progress.resources[resource->name()];
+                }
+                ++progress.states[ToString(item->state)];
+            }
+        }
+    }
+
+    json ret = json::array();
+    for (auto& pair : jobs) {
+        auto& progress = pair.second;
+        json job{
+            {"id", pair.first},
+            {"type", progress.type},
+            {"total_tasks", progress.total},
+            {"executed_tasks", progress.executed},
+            {"progress", (double)progress.executed / progress.total},
+            {"states", progress.states},
+            {"pending_on", progress.resources},
+        };
+        ret.push_back(job);
+    }
+    return ret;
+}
+
 bool
 ResourceMgr::check_resource_valid() {
     {
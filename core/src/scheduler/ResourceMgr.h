@@ -103,6 +103,14 @@ class ResourceMgr : public interface::dumpable {
     std::string
     DumpTaskTables();
 
+    // queue depth, task states and unfinished tasks of each resource
+    json
+    DumpTaskTableStates();
+
+    // progress of the jobs that still own tasks in some task table
+    json
+    DumpJobProgress();
+
  private:
     bool
     check_resource_valid();
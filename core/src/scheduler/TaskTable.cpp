@@ -11,12 +11,16 @@
 
 #include "scheduler/TaskTable.h"
 #include "Utils.h"
+#include "cache/CpuCacheMgr.h"
 #include "event/TaskTableUpdatedEvent.h"
 #include "scheduler/SchedInst.h"
+#include "scheduler/task/BuildIndexTask.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
+#include <algorithm>
 #include <ctime>
+#include <iterator>
 #include <sstream>
 #include <vector>
 
@@ -47,6 +51,67 @@ ToString(TaskTableItemState state) {
     }
 }
 
+std::string
+ToString(TaskPriority priority) {
+    switch (priority) {
+        case TaskPriority::INTERACTIVE_SEARCH:
+            return "INTERACTIVE_SEARCH";
+        case TaskPriority::BATCH_SEARCH:
+            return "BATCH_SEARCH";
+        case TaskPriority::BUILD_INDEX:
+            return "BUILD_INDEX";
+        case TaskPriority::DELETE:
+            return "DELETE";
+        default:
+            return "";
+    }
+}
+
+namespace {
+
+// relative share of picks each lane gets while all lanes have work
+constexpr int64_t LANE_WEIGHTS[] = {8, 4, 2, 1};
+static_assert(sizeof(LANE_WEIGHTS) / sizeof(LANE_WEIGHTS[0]) == static_cast<size_t>(TaskPriority::MAX),
+              "one weight per lane");
+static_assert(sizeof(TASK_STARVATION_MS) / sizeof(TASK_STARVATION_MS[0]) == static_cast<size_t>(TaskPriority::MAX),
+              "one starvation limit per lane");
+
+TaskPriority
+PriorityOf(const TaskPtr& task) {
+    switch (task->Type()) {
+        case TaskType::SearchTask: {
+            auto job = task->job_.lock();
+            if (job != nullptr && job->type() == JobType::SEARCH &&
+                std::static_pointer_cast<SearchJob>(job)->nq() >= BATCH_SEARCH_NQ) {
+                return TaskPriority::BATCH_SEARCH;
+            }
+            return TaskPriority::INTERACTIVE_SEARCH;
+        }
+        case TaskType::BuildIndexTask:
+            return TaskPriority::BUILD_INDEX;
+        case TaskType::DeleteTask:
+            return TaskPriority::DELETE;
+        default:
+            return TaskPriority::INTERACTIVE_SEARCH;
+    }
+}
+
+int64_t
+LoadCost(const TaskPtr& task) {
+    SegmentSchemaPtr file = nullptr;
+    if (task->Type() == TaskType::SearchTask) {
+        file = std::static_pointer_cast<XSearchTask>(task)->file_;
+    } else if (task->Type() == TaskType::BuildIndexTask) {
+        file = std::static_pointer_cast<XBuildIndexTask>(task)->file_;
+    }
+    if (file == nullptr || cache::CpuCacheMgr::GetInstance()->ItemExists(file->location_)) {
+        return 0;
+    }
+    return static_cast<int64_t>(file->file_size_);
+}
+
+}  // namespace
+
 json
 TaskTimestamp::Dump() const {
     json ret{
@@ -57,7 +122,7 @@ TaskTimestamp::Dump() const {
 }
 
 TaskPtr
-TaskTableItem::get_task() {
+TaskTableItem::get_task() const {
     std::lock_guard<std::mutex> lock(mutex);
     return this->task;
 }
@@ -149,12 +214,21 @@ TaskTableItem::Moved() {
 
 json
 TaskTableItem::Dump() const {
+    // the executor replaces the task with a finished one, copy it once under the item mutex
+    auto item_task = get_task();
     json ret{
         {"id", id},
-        {"task", (int64_t)task.get()},
+        {"task", (int64_t)item_task.get()},
         {"state", ToString(state)},
+        {"priority", ToString(priority)},
         {"timestamp", timestamp.Dump()},
     };
+    if (item_task != nullptr) {
+        ret["task_type"] = item_task->Type();
+        if (auto job = item_task->job_.lock()) {
+            ret["job_id"] = job->id();
+        }
+    }
     return ret;
 }
 
@@ -162,11 +236,27 @@ std::vector<uint64_t>
 TaskTable::PickToLoad(uint64_t limit) {
 #if 1
     // TimeRecorder rc("");
-    std::vector<uint64_t> indexes;
+    // loaded but not executed tasks, the loader works ahead of the executor within a memory budget
+    int64_t loaded_bytes = 0;
+    uint64_t loaded_count = 0;
+    for (uint64_t i = 0; i < table_.size(); ++i) {
+        auto index = table_.front() + 1 + i;
+        if (not table_[index] || index % table_.capacity() == table_.rear())
+            break;
+        if (table_[index]->state == TaskTableItemState::LOADED) {
+            loaded_bytes += table_[index]->load_cost;
+            ++loaded_count;
+        }
+    }
+    if (loaded_count >= LOAD_LOOKAHEAD_MAX)
+        return std::vector<uint64_t>();
+    auto budget = static_cast<int64_t>(cache::CpuCacheMgr::GetInstance()->CacheCapacity() * LOAD_LOOKAHEAD_CACHE_RATIO);
+
+    std::vector<std::vector<uint64_t>> lanes(static_cast<size_t>(TaskPriority::MAX));
     bool cross = false;
 
     uint64_t available_begin = table_.front() + 1;
-    for (uint64_t i = 0, loaded_count = 0, pick_count = 0; i < table_.size() && pick_count < limit; ++i) {
+    for (uint64_t i = 0, pick_count = 0; i < table_.size() && pick_count < limit * lanes.size(); ++i) {
         auto index = available_begin + i;
         if (not table_[index])
             break;
@@ -174,12 +264,12 @@ TaskTable::PickToLoad(uint64_t limit) {
             break;
         if (not cross && table_[index]->IsFinish()) {
             table_.set_front(index);
-        } else if (table_[index]->state == TaskTableItemState::LOADED) {
-            cross = true;
-            ++loaded_count;
-            if (loaded_count >= 1)
-                return std::vector<uint64_t>();
         } else if (table_[index]->state == TaskTableItemState::START) {
+            cross = true;
+            auto& lane = lanes[static_cast<size_t>(table_[index]->priority)];
+            if (lane.size() >= limit)
+                continue;
+
             auto task = table_[index]->get_task();
 
             // if task is a build index task, limit it
@@ -189,15 +279,25 @@ TaskTable::PickToLoad(uint64_t limit) {
                     continue;
                 }
             }
-            cross = true;
-            indexes.push_back(index);
+
+            // cold data waits until the executor drains what is already loaded
+            auto cost = LoadCost(task);
+            table_[index]->load_cost = cost;
+            if (cost > 0 && loaded_bytes > 0 && loaded_bytes + cost > budget)
+                continue;
+            lane.push_back(index);
             ++pick_count;
         } else {
             cross = true;
         }
     }
+
+    // cached segments go first so the executor is busy while cold ones load, fifo otherwise
+    for (auto& lane : lanes) {
+        std::stable_partition(lane.begin(), lane.end(), [&](uint64_t index) { return table_[index]->load_cost == 0; });
+    }
     // rc.ElapseFromBegin("PickToLoad ");
-    return indexes;
+    return Schedule(lanes, limit, load_credits_, load_lanes_);
 #else
     size_t count = 0;
     for (uint64_t j = last_finish_ + 1; j < table_.size(); ++j) {
@@ -248,10 +348,10 @@ TaskTable::PickToLoad(uint64_t limit) {
 std::vector<uint64_t>
 TaskTable::PickToExecute(uint64_t limit) {
     // TimeRecorder rc("");
-    std::vector<uint64_t> indexes;
+    std::vector<std::vector<uint64_t>> lanes(static_cast<size_t>(TaskPriority::MAX));
     bool cross = false;
     uint64_t available_begin = table_.front() + 1;
-    for (uint64_t i = 0, pick_count = 0; i < table_.size() && pick_count < limit; ++i) {
+    for (uint64_t i = 0, pick_count = 0; i < table_.size() && pick_count < limit * lanes.size(); ++i) {
         uint64_t index = available_begin + i;
         if (not table_[index]) {
             break;
@@ -264,20 +364,87 @@ TaskTable::PickToExecute(uint64_t limit) {
             table_.set_front(index);
         } else if (table_[index]->state == TaskTableItemState::LOADED) {
             cross = true;
-            indexes.push_back(index);
-            ++pick_count;
+            auto& lane = lanes[static_cast<size_t>(table_[index]->priority)];
+            if (lane.size() < limit) {
+                lane.push_back(index);
+                ++pick_count;
+            }
         } else {
             cross = true;
         }
     }
     // rc.ElapseFromBegin("PickToExecute ");
+    return Schedule(lanes, limit, execute_credits_, execute_lanes_);
+}
+
+std::vector<uint64_t>
+TaskTable::Schedule(std::vector<std::vector<uint64_t>>& lanes, uint64_t limit, const std::vector<int64_t>& credits,
+                    std::vector<bool>& active_lanes) {
+    std::vector<uint64_t> indexes;
+
+    // starvation protection, the oldest of the long waiting candidates go first whatever their lane
+    auto now = get_current_timestamp();
+    std::vector<uint64_t> starving;
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        auto& lane = lanes[i];
+        auto waiting = [&](uint64_t index) { return now >= table_[index]->timestamp.start + TASK_STARVATION_MS[i]; };
+        std::copy_if(lane.begin(), lane.end(), std::back_inserter(starving), waiting);
+        lane.erase(std::remove_if(lane.begin(), lane.end(), waiting), lane.end());
+        active_lanes[i] = !lane.empty();
+    }
+    std::sort(starving.begin(), starving.end(), [&](uint64_t l, uint64_t r) { return table_[l]->id < table_[r]->id; });
+    for (auto index : starving) {
+        if (indexes.size() >= limit) {
+            return indexes;
+        }
+        indexes.push_back(index);
+    }
+
+    // smooth weighted round robin over the lanes still holding candidates, fifo inside a lane, the caller takes
+    // the first candidate it can, so the rounds are simulated on a copy of the credits
+    auto simulated = credits;
+    std::vector<size_t> heads(lanes.size(), 0);
+    while (indexes.size() < limit) {
+        int64_t total = 0;
+        size_t best = lanes.size();
+        for (size_t i = 0; i < lanes.size(); ++i) {
+            if (heads[i] >= lanes[i].size()) {
+                continue;
+            }
+            simulated[i] += LANE_WEIGHTS[i];
+            total += LANE_WEIGHTS[i];
+            if (best == lanes.size() || simulated[i] > simulated[best]) {
+                best = i;
+            }
+        }
+        if (best == lanes.size()) {
+            break;
+        }
+        simulated[best] -= total;
+        indexes.push_back(lanes[best][heads[best]++]);
+    }
     return indexes;
 }
 
+void
+TaskTable::Charge(std::vector<int64_t>& credits, std::vector<bool>& active_lanes, TaskPriority priority) {
+    auto lane = static_cast<size_t>(priority);
+    active_lanes[lane] = true;
+    int64_t total = 0;
+    for (size_t i = 0; i < credits.size(); ++i) {
+        if (active_lanes[i]) {
+            credits[i] += LANE_WEIGHTS[i];
+            total += LANE_WEIGHTS[i];
+        }
+    }
+    credits[lane] -= total;
+}
+
 void
 TaskTable::Put(TaskPtr task, TaskTableItemPtr from) {
     auto item = std::make_shared<TaskTableItem>(std::move(from));
     item->id = id_++;
+    item->priority = PriorityOf(task);
     item->set_task(std::move(task));
     item->state = TaskTableItemState::START;
     item->timestamp.start = get_current_timestamp();
@@ -300,9 +467,48 @@ TaskTable::TaskToExecute() {
     return count;
 }
 
+std::map<std::string, uint64_t>
+TaskTable::StateCount() const {
+    std::map<std::string, uint64_t> count;
+    for (size_t i = 0; i < table_.size(); ++i) {
+        auto& item = table_[i];
+        if (item != nullptr) {
+            ++count[ToString(item->state)];
+        }
+    }
+    return count;
+}
+
+std::map<std::string, uint64_t>
+TaskTable::LaneCount() const {
+    std::map<std::string, uint64_t> count;
+    for (size_t i = 0; i < table_.size(); ++i) {
+        auto& item = table_[i];
+        if (item != nullptr && !item->IsFinish()) {
+            ++count[ToString(item->priority)];
+        }
+    }
+    return count;
+}
+
 json
 TaskTable::Dump() const {
-    json ret{{"error.message", "not support yet."}};
+    json tasks = json::array();
+    for (size_t i = 0; i < table_.size(); ++i) {
+        auto& item = table_[i];
+        if (item != nullptr && !item->IsFinish()) {
+            tasks.push_back(item->Dump());
+        }
+    }
+
+    json ret{
+        {"capacity", table_.capacity()},
+        {"size", table_.size()},
+        {"queue_depth", tasks.size()},
+        {"states", StateCount()},
+        {"lanes", LaneCount()},
+        {"tasks", tasks},
+    };
     return ret;
 }
 
@@ -13,6 +13,7 @@
 
 #include <deque>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -38,6 +39,34 @@ enum class TaskTableItemState {
     MOVED,      // moved, termination state
 };
 
+std::string
+ToString(TaskTableItemState state);
+
+// scheduling class of a task, each class is picked from its own lane
+enum class TaskPriority {
+    INTERACTIVE_SEARCH = 0,
+    BATCH_SEARCH,
+    BUILD_INDEX,
+    DELETE,
+    MAX,
+};
+
+std::string
+ToString(TaskPriority priority);
+
+// search jobs with at least this many queries are batch searches
+constexpr uint64_t BATCH_SEARCH_NQ = 100;
+
+// a task waiting longer than the limit of its lane is picked before any other lane, background lanes wait much
+// longer so that a backlog of builds doesn't overtake fresh interactive searches
+constexpr uint64_t TASK_STARVATION_MS[] = {2000, 10000, 60000, 60000};
+
+// cold data loaded ahead of the executor may take at most this share of the cpu cache
+constexpr double LOAD_LOOKAHEAD_CACHE_RATIO = 0.25;
+
+// at most this many tasks wait loaded for the executor
+constexpr uint64_t LOAD_LOOKAHEAD_MAX = 16;
+
 struct TaskTimestamp : public interface::dumpable {
     uint64_t start = 0;
     uint64_t move = 0;
@@ -65,12 +94,14 @@ struct TaskTableItem : public interface::dumpable {
 
     uint64_t id;               // auto increment from 0;
     TaskTableItemState state;  // the state;
-    std::mutex mutex;
+    mutable std::mutex mutex;
     TaskTimestamp timestamp;
     TaskTableItemPtr from;
+    TaskPriority priority = TaskPriority::INTERACTIVE_SEARCH;
+    int64_t load_cost = 0;  // bytes read from disk when loaded, 0 if the segment is cached
 
     TaskPtr
-    get_task();
+    get_task() const;
 
     void
     set_task(TaskPtr task);
@@ -105,7 +136,12 @@ struct TaskTableItem : public interface::dumpable {
 
 class TaskTable : public interface::dumpable {
  public:
-    TaskTable() : table_(TASK_TABLE_MAX_COUNT) {
+    TaskTable()
+        : table_(TASK_TABLE_MAX_COUNT),
+          load_credits_(static_cast<size_t>(TaskPriority::MAX), 0),
+          execute_credits_(static_cast<size_t>(TaskPriority::MAX), 0),
+          load_lanes_(static_cast<size_t>(TaskPriority::MAX), false),
+          execute_lanes_(static_cast<size_t>(TaskPriority::MAX), false) {
     }
 
     TaskTable(const TaskTable&) = delete;
@@ -133,6 +169,14 @@ class TaskTable : public interface::dumpable {
     std::vector<uint64_t>
     PickToExecute(uint64_t limit);
 
+    // number of items in each state, including finished ones still kept in the table
+    std::map<std::string, uint64_t>
+    StateCount() const;
+
+    // number of unfinished items in each lane
+    std::map<std::string, uint64_t>
+    LaneCount() const;
+
  public:
     inline const TaskTableItemPtr& operator[](uint64_t index) {
         return table_[index];
@@ -164,7 +208,11 @@ class TaskTable : public interface::dumpable {
      */
     inline bool
     Load(uint64_t index) {
-        return table_[index]->Load();
+        if (not table_[index]->Load()) {
+            return false;
+        }
+        Charge(load_credits_, load_lanes_, table_[index]->priority);
+        return true;
     }
 
     /*
@@ -184,7 +232,11 @@ class TaskTable : public interface::dumpable {
      */
     inline bool
     Execute(uint64_t index) {
-        return table_[index]->Execute();
+        if (not table_[index]->Execute()) {
+            return false;
+        }
+        Charge(execute_credits_, execute_lanes_, table_[index]->priority);
+        return true;
     }
 
     /*
@@ -218,11 +270,29 @@ class TaskTable : public interface::dumpable {
         return table_[index]->Moved();
     }
 
+ private:
+    // merge per lane fifo candidates into one pick order, starving items first, then weighted round robin,
+    // the credits are only charged by Charge() for the candidate actually taken
+    std::vector<uint64_t>
+    Schedule(std::vector<std::vector<uint64_t>>& lanes, uint64_t limit, const std::vector<int64_t>& credits,
+             std::vector<bool>& active_lanes);
+
+    // one weighted round robin round among the lanes which had candidates in the last pick, won by the given lane
+    void
+    Charge(std::vector<int64_t>& credits, std::vector<bool>& active_lanes, TaskPriority priority);
+
  private:
     std::uint64_t id_ = 0;
     CircleQueue<TaskTableItemPtr> table_;
     std::function<void(void)> subscriber_ = nullptr;
 
+    // smooth weighted round robin state, loader and executor run in different threads
+    std::vector<int64_t> load_credits_;
+    std::vector<int64_t> execute_credits_;
+    // lanes which had candidates in the last pick
+    std::vector<bool> load_lanes_;
+    std::vector<bool> execute_lanes_;
+
     // cache last finish avoid Pick task from begin always
     // pick from (last_finish_ + 1)
     // init with -1, pick from (last_finish_ + 1) = 0
@@ -73,6 +73,11 @@ SearchJob::GetStatus() {
     return status_;
 }
 
+bool
+SearchJob::IsCanceled() const {
+    return context_ != nullptr && context_->IsCanceled();
+}
+
 json
 SearchJob::Dump() const {
     json ret{
@@ -68,6 +68,10 @@ class SearchJob : public Job {
     Status&
     GetStatus();
 
+    // the client has given up, remaining search tasks could be skipped
+    bool
+    IsCanceled() const;
+
     json
     Dump() const override;
 
@@ -95,6 +99,17 @@ class SearchJob : public Job {
         return vectors_;
     }
 
+    // the collection searched by the client, the tasks on its partitions are accounted to it
+    const std::string&
+    collection_id() const {
+        return collection_id_;
+    }
+
+    void
+    set_collection_id(const std::string& collection_id) {
+        collection_id_ = collection_id;
+    }
+
     Id2IndexMap&
     index_files() {
         return index_files_;
@@ -123,6 +138,7 @@ class SearchJob : public Job {
  private:
     const std::shared_ptr<server::Context> context_;
 
+    std::string collection_id_;
     uint64_t topk_ = 0;
     milvus::json extra_params_;
     // TODO: smart pointer
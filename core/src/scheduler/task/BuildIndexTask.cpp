@@ -124,6 +124,8 @@ XBuildIndexTask::Execute() {
             return;
         }
 
+        server::CollectCollectionTaskMetrics task_metrics(file_->collection_id_,
+                                                          server::CollectionTaskType::BUILD_INDEX);
         std::string location = file_->location_;
         std::shared_ptr<engine::ExecutionEngine> index;
 
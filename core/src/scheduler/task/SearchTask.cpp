@@ -14,12 +14,14 @@
 #include <fiu-local.h>
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <utility>
 
+#include "cache/CpuCacheMgr.h"
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
 #include "index/knowhere/knowhere/index/vector_index/helpers/IndexParameter.h"
@@ -134,15 +136,28 @@ XSearchTask::XSearchTask(const std::shared_ptr<server::Context>& context, Segmen
 void
 XSearchTask::Load(LoadType type, uint8_t device_id) {
     milvus::server::ContextFollower tracer(context_, "XSearchTask::Load " + std::to_string(file_->id_));
+    tracer.SetTag("segment_id", file_->segment_id_);
+
+    if (auto job = job_.lock()) {
+        auto search_job = std::static_pointer_cast<scheduler::SearchJob>(job);
+        if (search_job->IsCanceled()) {
+            // no need to load the index file, the task will be skipped in Execute()
+            index_id_ = file_->id_;
+            index_type_ = file_->file_type_;
+            return;
+        }
+    }
 
     TimeRecorder rc(LogOut("[%s][%ld]", "search", 0));
     Status stat = Status::OK();
     std::string error_msg;
     std::string type_str;
+    milvus::server::ContextStage load_stage(context_, milvus::server::SearchStage::LOAD);
 
     try {
         fiu_do_on("XSearchTask.Load.throw_std_exception", throw std::exception());
         if (type == LoadType::DISK2CPU) {
+            cache_hit_ = cache::CpuCacheMgr::GetInstance()->ItemExists(file_->location_);
             stat = index_engine_->Load(true);
             type_str = "DISK2CPU";
         } else if (type == LoadType::CPU2GPU) {
@@ -169,6 +184,7 @@ XSearchTask::Load(LoadType type, uint8_t device_id) {
         stat = Status(SERVER_UNEXPECTED_ERROR, error_msg);
     }
     fiu_do_on("XSearchTask.Load.out_of_memory", stat = Status(SERVER_UNEXPECTED_ERROR, "out of memory"));
+    load_stage.Finish();
 
     if (!stat.ok()) {
         Status s;
@@ -186,6 +202,7 @@ XSearchTask::Load(LoadType type, uint8_t device_id) {
             search_job->SearchDone(file_->id_);
         }
 
+        tracer.SetTag("error", true);
         return;
     }
 
@@ -194,7 +211,14 @@ XSearchTask::Load(LoadType type, uint8_t device_id) {
     std::string info = "Search task load file id:" + std::to_string(file_->id_) + " " + type_str +
                        " file type:" + std::to_string(file_->file_type_) + " size:" + std::to_string(file_size) +
                        " bytes from location: " + file_->location_ + " totally cost";
-    rc.ElapseFromBegin(info);
+    load_us_ = rc.ElapseFromBegin(info);
+    if (type == LoadType::DISK2CPU && !cache_hit_) {
+        bytes_read_ = static_cast<int64_t>(file_size);
+    }
+    tracer.SetTag("load_type", type_str);
+    tracer.SetTag("bytes", static_cast<uint64_t>(file_size));
+    tracer.SetTag("bytes_read", bytes_read_);
+    tracer.SetTag("cache_hit", cache_hit_);
 
     CollectFileMetrics(file_->file_type_, file_size);
 
@@ -213,6 +237,7 @@ XSearchTask::Execute() {
 
     //    TimeRecorder rc("DoSearch file id:" + std::to_string(index_id_));
     TimeRecorder rc(LogOut("[%s][%ld] DoSearch file id:%ld", "search", 0, index_id_));
+    auto execute_start = std::chrono::steady_clock::now();
 
     server::CollectDurationMetrics metrics(index_type_);
 
@@ -222,6 +247,14 @@ XSearchTask::Execute() {
     if (auto job = job_.lock()) {
         auto search_job = std::static_pointer_cast<scheduler::SearchJob>(job);
 
+        if (search_job->IsCanceled()) {
+            LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld] SearchJob %ld canceled, skip index file: %ld", "search", 0,
+                                        search_job->id(), index_id_);
+            search_job->GetStatus() = Status(SERVER_REQUEST_CANCELED, "Search canceled by client");
+            search_job->SearchDone(index_id_);
+            return;
+        }
+
         if (index_engine_ == nullptr) {
             search_job->SearchDone(index_id_);
             return;
@@ -318,6 +351,7 @@ XSearchTask::Execute() {
                 return;
             }
 #endif
+            milvus::server::ContextStage search_stage(context_, milvus::server::SearchStage::SEARCH);
             if (!vectors.float_data_.empty()) {
                 s = index_engine_->Search(nq, vectors.float_data_.data(), topk, extra_params, output_distance.data(),
                                           output_ids.data(), hybrid);
@@ -325,6 +359,7 @@ XSearchTask::Execute() {
                 s = index_engine_->Search(nq, vectors.binary_data_.data(), topk, extra_params, output_distance.data(),
                                           output_ids.data(), hybrid);
             }
+            search_stage.Finish();
 
             fiu_do_on("XSearchTask.Execute.search_fail", s = Status(SERVER_UNEXPECTED_ERROR, ""));
 
@@ -343,6 +378,7 @@ XSearchTask::Execute() {
                 LOG_ENGINE_WARNING_ << LogOut("[%s][%ld] Searching in an empty file. file location = %s", "search", 0,
                                               file_->location_.c_str());
             } else {
+                milvus::server::ContextStage reduce_stage(context_, milvus::server::SearchStage::REDUCE);
                 std::unique_lock<std::mutex> lock(search_job->mutex());
                 XSearchTask::MergeTopkToResultSet(output_ids, output_distance, spec_k, nq, topk, ascending_reduce,
                                                   search_job->GetResultIds(), search_job->GetResultDistances());
@@ -363,6 +399,15 @@ XSearchTask::Execute() {
         }
 
         // step 4: notify to send result to client
+        auto execute_us =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - execute_start).count();
+        AddProfile(execute_us);
+        if (file_ != nullptr) {
+            // a partition file is charged to the searched collection, as the search request itself is
+            auto& collection_id =
+                search_job->collection_id().empty() ? file_->collection_id_ : search_job->collection_id();
+            server::CollectionAccounting::GetInstance().AddSearchTask(collection_id, file_->row_count_, execute_us);
+        }
         search_job->SearchDone(index_id_);
     }
 
@@ -381,6 +426,37 @@ XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const sch
     size_t tar_k = tar_ids.size() / nq;
     size_t buf_k = std::min(topk, src_k + tar_k);
 
+    if (buf_k == tar_k) {
+        // the result set is already full, merge every row in place through one row of scratch space,
+        // so merging a segment never holds a second nq * topk copy of the result set
+        scheduler::ResultIds row_ids(tar_k);
+        scheduler::ResultDistances row_distances(tar_k);
+        for (uint64_t i = 0; i < nq; i++) {
+            size_t src_k_multi_i = topk * i;
+            size_t tar_k_multi_i = tar_k * i;
+            std::copy_n(tar_ids.begin() + tar_k_multi_i, tar_k, row_ids.begin());
+            std::copy_n(tar_distances.begin() + tar_k_multi_i, tar_k, row_distances.begin());
+
+            size_t src_k_j = 0, row_k_j = 0;
+            for (size_t buf_k_j = 0; buf_k_j < buf_k; buf_k_j++) {
+                size_t src_idx = src_k_multi_i + src_k_j;
+                size_t tar_idx = tar_k_multi_i + buf_k_j;
+                if (src_k_j < src_k && ((row_ids[row_k_j] == -1) ||  // initialized value
+                                        (ascending && src_distances[src_idx] < row_distances[row_k_j]) ||
+                                        (!ascending && src_distances[src_idx] > row_distances[row_k_j]))) {
+                    tar_ids[tar_idx] = src_ids[src_idx];
+                    tar_distances[tar_idx] = src_distances[src_idx];
+                    src_k_j++;
+                } else {
+                    tar_ids[tar_idx] = row_ids[row_k_j];
+                    tar_distances[tar_idx] = row_distances[row_k_j];
+                    row_k_j++;
+                }
+            }
+        }
+        return;
+    }
+
     scheduler::ResultIds buf_ids(nq * buf_k, -1);
     scheduler::ResultDistances buf_distances(nq * buf_k, 0.0);
 
@@ -437,6 +513,24 @@ XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const sch
     tar_distances.swap(buf_distances);
 }
 
+void
+XSearchTask::AddProfile(double execute_us) {
+    if (context_ == nullptr || context_->GetStageTimer() == nullptr || file_ == nullptr) {
+        return;
+    }
+
+    server::TaskProfile profile;
+    profile.file_id_ = file_->id_;
+    profile.segment_id_ = file_->segment_id_;
+    profile.file_type_ = file_->file_type_;
+    profile.resource_ = path().Last();
+    profile.load_us_ = load_us_;
+    profile.execute_us_ = execute_us;
+    profile.cache_hit_ = cache_hit_;
+    profile.bytes_read_ = bytes_read_;
+    context_->GetStageTimer()->AddTask(profile);
+}
+
 const std::string&
 XSearchTask::GetLocation() const {
     return file_->location_;
@@ -50,6 +50,11 @@ class XSearchTask : public Task {
     size_t
     GetIndexId() const;
 
+ private:
+    // report load and execute details of the task to the request's stage timer
+    void
+    AddProfile(double execute_us);
+
  public:
     const std::shared_ptr<server::Context> context_;
 
@@ -62,6 +67,10 @@ class XSearchTask : public Task {
     // distance -- value 0 means two vectors equal, ascending reduce, L2/HAMMING/JACCARD/TONIMOTO ...
     // similarity -- infinity value means two vectors equal, descending reduce, IP
     bool ascending_reduce = true;
+
+    double load_us_ = 0;
+    bool cache_hit_ = false;
+    int64_t bytes_read_ = 0;
 };
 
 }  // namespace scheduler
@@ -160,6 +160,33 @@ DBWrapper::StartService() {
     }
     faiss::distance_compute_blas_threshold = use_blas_threshold;
 
+    // a read-only node cannot see meta writes made by the writable node, so it always reads the backend
+    bool meta_cache_enable = false;
+    s = config.GetEngineConfigMetaCacheEnable(meta_cache_enable);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+    opt.meta_.cache_enable_ = meta_cache_enable && opt.mode_ != engine::DBOptions::MODE::CLUSTER_READONLY;
+
+    s = config.GetEngineConfigRecallSampleRatio(opt.recall_sample_ratio_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetEngineConfigAutoTuneTargetRecall(opt.auto_tune_target_recall_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetEngineConfigAutoTuneLatencySloMs(opt.auto_tune_latency_slo_ms_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
     // set archive config
     engine::ArchiveConf::CriteriaT criterial;
     int64_t disk, days;
@@ -0,0 +1,294 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/Profiler.h"
+
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <malloc.h>
+#include <signal.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef ENABLE_CPU_PROFILING
+#include <gperftools/profiler.h>
+#endif
+#ifdef ENABLE_MEM_PROFILING
+#include <gperftools/malloc_extension.h>
+#endif
+
+#include "utils/CommonUtil.h"
+#include "utils/Log.h"
+#include "utils/StringHelpFunctions.h"
+
+namespace milvus {
+namespace server {
+
+namespace {
+
+constexpr int64_t DEFAULT_PROFILE_SECONDS = 10;
+constexpr int64_t MAX_PROFILE_SECONDS = 300;
+constexpr int64_t SAMPLE_FREQUENCY = 100;  // samples per cpu second
+constexpr int64_t MAX_SAMPLES = 1 << 16;
+constexpr int MAX_DEPTH = 64;
+constexpr int SKIPPED_FRAMES = 2;  // the signal handler and the signal trampoline
+
+struct StackSample {
+    int depth_;
+    void* frames_[MAX_DEPTH];
+};
+
+// written by the SIGPROF handler, which may only touch preallocated memory and lock-free atomics
+std::atomic<bool> sampling{false};
+std::atomic<int64_t> in_handler{0};
+std::atomic<int64_t> sample_count{0};
+StackSample* samples = nullptr;
+int64_t sample_capacity = 0;
+
+void
+ProfSignalHandler(int, siginfo_t*, void*) {
+    in_handler.fetch_add(1);
+    if (sampling.load()) {
+        int saved_errno = errno;
+        int64_t index = sample_count.fetch_add(1);
+        if (index < sample_capacity) {
+            samples[index].depth_ = backtrace(samples[index].frames_, MAX_DEPTH);
+        }
+        errno = saved_errno;
+    }
+    in_handler.fetch_sub(1);
+}
+
+std::string
+Symbolize(void* address) {
+    // return addresses point after the call instruction
+    void* pc = reinterpret_cast<char*>(address) - 1;
+    Dl_info info;
+    if (dladdr(pc, &info) == 0) {
+        std::ostringstream ss;
+        ss << address;
+        return ss.str();
+    }
+
+    std::string name;
+    if (info.dli_sname != nullptr) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        name = (status == 0 && demangled != nullptr) ? demangled : info.dli_sname;
+        free(demangled);
+    } else {
+        // not exported, keep the module offset so that it can be resolved offline with addr2line
+        std::string module = info.dli_fname != nullptr ? info.dli_fname : "??";
+        std::ostringstream ss;
+        ss << module.substr(module.find_last_of('/') + 1) << "+0x" << std::hex
+           << (reinterpret_cast<uintptr_t>(pc) - reinterpret_cast<uintptr_t>(info.dli_fbase));
+        name = ss.str();
+    }
+
+    // ';' separates frames in the folded format
+    std::replace(name.begin(), name.end(), ';', ':');
+    return name;
+}
+
+}  // namespace
+
+Status
+Profiler::ProcessProfileCli(std::string& result, const std::string& cmd) {
+    std::vector<std::string> tokens;
+    StringHelpFunctions::SplitStringByDelimeter(cmd, " ", tokens);
+    tokens.erase(std::remove(tokens.begin(), tokens.end(), ""), tokens.end());
+
+    if (tokens.size() == 2 && tokens[1] == "heap") {
+        return HeapProfile(result);
+    }
+
+    if (tokens.size() >= 2 && tokens[1] == "cpu" && tokens.size() <= 4) {
+        int64_t seconds = DEFAULT_PROFILE_SECONDS;
+        if (tokens.size() >= 3) {
+            try {
+                seconds = std::stol(tokens[2]);
+            } catch (std::exception& e) {
+                return Status(SERVER_INVALID_ARGUMENT, "Invalid profile seconds: " + tokens[2]);
+            }
+        }
+        std::string format = tokens.size() == 4 ? tokens[3] : "folded";
+        return CpuProfile(seconds, format, result);
+    }
+
+    return Status(SERVER_INVALID_ARGUMENT, "Usage: profile cpu [seconds] [folded|pprof] | profile heap");
+}
+
+Status
+Profiler::CpuProfile(int64_t seconds, const std::string& format, std::string& result) {
+    if (seconds <= 0 || seconds > MAX_PROFILE_SECONDS) {
+        return Status(SERVER_INVALID_ARGUMENT,
+                      "Profile seconds must be in range [1, " + std::to_string(MAX_PROFILE_SECONDS) + "]");
+    }
+    if (format != "folded" && format != "pprof") {
+        return Status(SERVER_INVALID_ARGUMENT, "Unknown profile format: " + format);
+    }
+
+    std::unique_lock<std::mutex> lock(cpu_mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return Status(SERVER_UNEXPECTED_ERROR, "Another cpu profile is running");
+    }
+
+    LOG_SERVER_INFO_ << "Start " << format << " cpu profile for " << seconds << " seconds";
+    return format == "folded" ? SampleFolded(seconds, result) : SamplePprof(seconds, result);
+}
+
+Status
+Profiler::HeapProfile(std::string& result) {
+#ifdef ENABLE_MEM_PROFILING
+    MallocExtension::instance()->GetHeapSample(&result);
+    if (result.empty()) {
+        return Status(SERVER_UNEXPECTED_ERROR, "Empty heap sample, start milvus with TCMALLOC_SAMPLE_PARAMETER set");
+    }
+    return Status::OK();
+#else
+    char* buffer = nullptr;
+    size_t size = 0;
+    FILE* stream = open_memstream(&buffer, &size);
+    if (stream == nullptr) {
+        return Status(SERVER_UNEXPECTED_ERROR, "Failed to open memory stream for malloc_info");
+    }
+    int ret = malloc_info(0, stream);
+    fclose(stream);
+    if (ret == 0) {
+        result.assign(buffer, size);
+    }
+    free(buffer);
+
+    if (ret != 0) {
+        return Status(SERVER_UNEXPECTED_ERROR, "malloc_info failed");
+    }
+    return Status::OK();
+#endif
+}
+
+Status
+Profiler::SampleFolded(int64_t seconds, std::string& result) {
+    // the timer counts cpu time of the whole process, so every core adds up to SAMPLE_FREQUENCY samples per second
+    int64_t expected = seconds * SAMPLE_FREQUENCY * std::max(std::thread::hardware_concurrency(), 1U);
+    std::vector<StackSample> buffer(std::min(expected, MAX_SAMPLES));
+    samples = buffer.data();
+    sample_capacity = buffer.size();
+    sample_count = 0;
+
+    // the first backtrace() call loads libgcc, which is not allowed in a signal handler
+    void* warm_up[1];
+    backtrace(warm_up, 1);
+
+    struct sigaction action {};
+    action.sa_sigaction = ProfSignalHandler;
+    action.sa_flags = SA_RESTART | SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, nullptr) != 0) {
+        return Status(SERVER_UNEXPECTED_ERROR, "Failed to install SIGPROF handler");
+    }
+
+    struct itimerval timer {};
+    timer.it_interval.tv_usec = 1000000 / SAMPLE_FREQUENCY;
+    timer.it_value = timer.it_interval;
+    sampling = true;
+    setitimer(ITIMER_PROF, &timer, nullptr);
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+
+    struct itimerval stop_timer {};
+    setitimer(ITIMER_PROF, &stop_timer, nullptr);
+    sampling = false;
+    while (in_handler.load() > 0) {
+        std::this_thread::yield();
+    }
+    // the handler stays installed and ignores signals while not sampling, restoring the default action would let
+    // a SIGPROF still pending on some thread terminate the process
+
+    int64_t count = std::min(sample_count.load(), sample_capacity);
+    if (sample_count.load() > sample_capacity) {
+        LOG_SERVER_WARNING_ << "Cpu profile dropped " << sample_count.load() - sample_capacity << " samples";
+    }
+
+    std::map<std::vector<void*>, int64_t> stacks;
+    for (int64_t i = 0; i < count; ++i) {
+        auto& sample = buffer[i];
+        if (sample.depth_ <= SKIPPED_FRAMES) {
+            continue;
+        }
+        // root first
+        std::vector<void*> stack(sample.frames_ + SKIPPED_FRAMES, sample.frames_ + sample.depth_);
+        std::reverse(stack.begin(), stack.end());
+        ++stacks[stack];
+    }
+    samples = nullptr;
+    sample_capacity = 0;
+
+    std::unordered_map<void*, std::string> names;
+    std::vector<std::pair<std::string, int64_t>> lines;
+    for (auto& stack : stacks) {
+        std::string line;
+        for (auto address : stack.first) {
+            auto iter = names.find(address);
+            if (iter == names.end()) {
+                iter = names.emplace(address, Symbolize(address)).first;
+            }
+            line += line.empty() ? iter->second : ";" + iter->second;
+        }
+        lines.emplace_back(std::move(line), stack.second);
+    }
+    std::sort(lines.begin(), lines.end(), [](auto& l, auto& r) { return l.second > r.second; });
+
+    std::ostringstream ss;
+    for (auto& line : lines) {
+        ss << line.first << " " << line.second << "\n";
+    }
+    result = ss.str();
+    return Status::OK();
+}
+
+Status
+Profiler::SamplePprof(int64_t seconds, std::string& result) {
+#ifdef ENABLE_CPU_PROFILING
+    std::string file_path = "/tmp/milvus_cpu_" + CommonUtil::GetCurrentTimeStr() + ".prof";
+    if (ProfilerStart(file_path.c_str()) == 0) {
+        return Status(SERVER_UNEXPECTED_ERROR, "Failed to start gperftools profiler");
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    ProfilerStop();
+
+    std::ifstream file(file_path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(file_path.c_str());
+
+    result = StringHelpFunctions::EncodeBase64(bytes.data(), bytes.size());
+    return Status::OK();
+#else
+    return Status(SERVER_UNSUPPORTED_ERROR, "pprof cpu profile needs a build with ENABLE_CPU_PROFILING=ON");
+#endif
+}
+
+}  // namespace server
+}  // namespace milvus
@@ -0,0 +1,62 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <mutex>
+#include <string>
+
+#include "utils/Status.h"
+
+namespace milvus {
+namespace server {
+
+// On-demand profiles of the running process, served by the "profile" cmd and GET /system/profile:
+//   profile cpu [seconds] [folded|pprof]
+//   profile heap
+// The folded cpu profile (one "frame;frame;... count" line per stack) needs nothing but glibc, pprof needs a build
+// with ENABLE_CPU_PROFILING and comes base64 encoded. The heap profile is a tcmalloc heap sample when built with
+// ENABLE_MEM_PROFILING, otherwise the glibc malloc_info() report.
+class Profiler {
+ private:
+    Profiler() = default;
+    ~Profiler() = default;
+
+ public:
+    static Profiler&
+    GetInstance() {
+        static Profiler instance;
+        return instance;
+    }
+
+    Status
+    ProcessProfileCli(std::string& result, const std::string& cmd);
+
+    // blocks the caller for the given seconds, one cpu profile runs at a time
+    Status
+    CpuProfile(int64_t seconds, const std::string& format, std::string& result);
+
+    Status
+    HeapProfile(std::string& result);
+
+ private:
+    Status
+    SampleFolded(int64_t seconds, std::string& result);
+
+    Status
+    SamplePprof(int64_t seconds, std::string& result);
+
+ private:
+    std::mutex cpu_mutex_;
+};
+
+}  // namespace server
+}  // namespace milvus
@@ -28,6 +28,7 @@
 #include "metrics/Metrics.h"
 #include "scheduler/SchedInst.h"
 #include "server/DBWrapper.h"
+#include "server/SlowQueryLog.h"
 #include "server/grpc_impl/GrpcServer.h"
 #include "server/init/CpuChecker.h"
 #include "server/init/GpuChecker.h"
@@ -79,8 +80,13 @@ Server::Start() {
         /* Init opentracing tracer from config */
         std::string tracing_config_path;
         s = config.GetTracingConfigJsonConfigPath(tracing_config_path);
-        tracing_config_path.empty() ? tracing::TracerUtil::InitGlobal()
-                                    : tracing::TracerUtil::InitGlobal(tracing_config_path);
+        std::string tracing_exporter_path;
+        STATUS_CHECK(config.GetTracingConfigExporterPath(tracing_exporter_path));
+        tracing::TracerUtil::InitGlobal(tracing_config_path, tracing_exporter_path);
+
+        float tracing_sample_rate;
+        STATUS_CHECK(config.GetTracingConfigSampleRate(tracing_sample_rate));
+        tracing::TracerUtil::SetSampleRate(tracing_sample_rate);
 
         /* Set timezone */
         std::string time_zone;
@@ -136,6 +142,12 @@ Server::Start() {
             STATUS_CHECK(config.GetLogsLogToFile(log_to_file));
             InitLog(trace_enable, debug_enable, info_enable, warning_enable, error_enable, fatal_enable, logs_path,
                     max_log_file_size, delete_exceeds, log_to_stdout, log_to_file);
+            if (log_to_file) {
+                auto slow_log_status = SlowQueryLog::GetInstance().Init(logs_path, max_log_file_size, delete_exceeds);
+                if (!slow_log_status.ok()) {
+                    LOG_SERVER_WARNING_ << slow_log_status.message();
+                }
+            }
         }
 
         bool cluster_enable = false;
@@ -0,0 +1,192 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/SlowQueryLog.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include "config/Config.h"
+#include "server/context/Context.h"
+#include "utils/CommonUtil.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace server {
+
+namespace {
+constexpr size_t RECENT_ENTRY_COUNT = 100;
+
+const char*
+RequestName(BaseRequest::RequestType type) {
+    switch (type) {
+        case BaseRequest::kSearchByID:
+            return "search_by_id";
+        case BaseRequest::kSearch:
+            return "search";
+        case BaseRequest::kSearchCombine:
+            return "search_combine";
+        case BaseRequest::kSearchMulti:
+            return "search_multi";
+        default:
+            return "unknown";
+    }
+}
+
+// local time in ISO-8601 with milliseconds and utc offset, such as 2020-04-01T10:20:30.123+0800
+std::string
+CurrentTimeStr() {
+    auto now = std::chrono::system_clock::now();
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+    tm local_time;
+    CommonUtil::ConvertTime(std::chrono::system_clock::to_time_t(now), local_time);
+
+    std::stringstream ss;
+    ss << std::put_time(&local_time, "%Y-%m-%dT%H:%M:%S") << "." << std::setw(3) << std::setfill('0')
+       << milliseconds << std::put_time(&local_time, "%z");
+    return ss.str();
+}
+}  // namespace
+
+Status
+SlowQueryLog::Init(const std::string& logs_path, int64_t max_file_size, int64_t rotate_num) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string dir = logs_path.rfind('/') == logs_path.length() - 1 ? logs_path : logs_path + "/";
+    file_path_ = dir + "milvus-slow-query.log";
+    max_file_size_ = max_file_size;
+    rotate_num_ = rotate_num;
+
+    boost::system::error_code err;
+    boost::filesystem::create_directories(dir, err);
+
+    file_.open(file_path_, std::ios::out | std::ios::app);
+    if (!file_.is_open()) {
+        return Status(SERVER_CANNOT_CREATE_FILE, "Cannot open slow query log: " + file_path_);
+    }
+    file_size_ = static_cast<int64_t>(file_.tellp());
+    return Status::OK();
+}
+
+void
+SlowQueryLog::Record(const BaseRequest& request, double total_us) {
+    int64_t threshold_ms = 0;
+    Config::GetInstance().GetEngineConfigSlowQueryThreshold(threshold_ms);
+    if (threshold_ms <= 0 || total_us < threshold_ms * 1000.0) {
+        return;
+    }
+
+    milvus::json entry;
+    entry["time"] = CurrentTimeStr();
+    entry["request"] = RequestName(request.GetRequestType());
+    entry["total_ms"] = total_us / 1000;
+    entry["status"] = request.status().code();
+
+    milvus::json params;
+    request.DescribeParams(params);
+    entry["params"] = params;
+
+    auto& context = request.Context();
+    if (context != nullptr) {
+        entry["request_id"] = context->RequestID();
+    }
+
+    if (context != nullptr && context->GetStageTimer() != nullptr) {
+        auto& stage_timer = context->GetStageTimer();
+        milvus::json stages;
+        for (size_t i = 0; i < static_cast<size_t>(SearchStage::COUNT); ++i) {
+            auto stage = static_cast<SearchStage>(i);
+            stages[std::string(StageTimer::StageName(stage)) + "_ms"] = stage_timer->Get(stage) / 1000;
+        }
+        entry["stages"] = stages;
+
+        int64_t bytes_read = 0;
+        milvus::json tasks = milvus::json::array();
+        for (auto& task : stage_timer->Tasks()) {
+            milvus::json task_json;
+            task_json["file_id"] = task.file_id_;
+            task_json["segment_id"] = task.segment_id_;
+            task_json["file_type"] = task.file_type_;
+            task_json["resource"] = task.resource_;
+            task_json["load_ms"] = task.load_us_ / 1000;
+            task_json["execute_ms"] = task.execute_us_ / 1000;
+            task_json["cache"] = task.cache_hit_ ? "hit" : "miss";
+            task_json["bytes_read"] = task.bytes_read_;
+            tasks.push_back(task_json);
+            bytes_read += task.bytes_read_;
+        }
+        entry["files_searched"] = tasks.size();
+        entry["bytes_read"] = bytes_read;
+        entry["tasks"] = tasks;
+    }
+
+    Write(entry);
+}
+
+std::string
+SlowQueryLog::Dump() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string result = "[";
+    for (size_t i = 0; i < recent_entries_.size(); ++i) {
+        if (i > 0) {
+            result += ",";
+        }
+        result += recent_entries_[i];
+    }
+    result += "]";
+    return result;
+}
+
+void
+SlowQueryLog::Write(const milvus::json& entry) {
+    std::string line = entry.dump();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    recent_entries_.push_back(line);
+    if (recent_entries_.size() > RECENT_ENTRY_COUNT) {
+        recent_entries_.pop_front();
+    }
+
+    if (!file_.is_open()) {
+        return;
+    }
+
+    file_ << line << std::endl;
+    file_size_ += static_cast<int64_t>(line.size()) + 1;
+    if (max_file_size_ > 0 && file_size_ >= max_file_size_) {
+        Rotate();
+    }
+}
+
+void
+SlowQueryLog::Rotate() {
+    // same naming as the other logs: the full file gets an increasing suffix, the oldest ones beyond
+    // the rotate number are deleted
+    file_.close();
+    std::string rotated_path = file_path_ + "." + std::to_string(++rotate_idx_);
+    std::rename(file_path_.c_str(), rotated_path.c_str());
+    if (rotate_num_ > 0 && rotate_idx_ - rotate_num_ > 0) {
+        boost::system::error_code err;
+        boost::filesystem::remove(file_path_ + "." + std::to_string(rotate_idx_ - rotate_num_), err);
+    }
+
+    file_.open(file_path_, std::ios::out | std::ios::trunc);
+    file_size_ = 0;
+    if (!file_.is_open()) {
+        LOG_SERVER_ERROR_ << "Cannot reopen slow query log: " << file_path_;
+    }
+}
+
+}  // namespace server
+}  // namespace milvus
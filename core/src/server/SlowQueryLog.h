@@ -0,0 +1,71 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+#include "server/delivery/request/BaseRequest.h"
+#include "utils/Json.h"
+#include "utils/Status.h"
+
+namespace milvus {
+namespace server {
+
+// Search requests slower than engine_config.slow_query_threshold, with their execution profile. The entries are
+// written to a rotating file under the log path, and the most recent ones are kept in memory for the slow_log cmd.
+class SlowQueryLog {
+ private:
+    SlowQueryLog() = default;
+    ~SlowQueryLog() = default;
+
+ public:
+    static SlowQueryLog&
+    GetInstance() {
+        static SlowQueryLog instance;
+        return instance;
+    }
+
+    // before Init() is called the entries are only kept in memory
+    Status
+    Init(const std::string& logs_path, int64_t max_file_size, int64_t rotate_num);
+
+    // record the request if it took longer than the threshold
+    void
+    Record(const BaseRequest& request, double total_us);
+
+    // the most recent entries as a json array, oldest first
+    std::string
+    Dump();
+
+ private:
+    void
+    Write(const milvus::json& entry);
+
+    void
+    Rotate();
+
+ private:
+    std::mutex mutex_;
+    std::string file_path_;
+    std::ofstream file_;
+    int64_t file_size_ = 0;
+    int64_t max_file_size_ = 0;
+    int64_t rotate_num_ = 0;
+    int64_t rotate_idx_ = 0;
+    std::deque<std::string> recent_entries_;
+};
+
+}  // namespace server
+}  // namespace milvus
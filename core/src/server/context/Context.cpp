@@ -22,6 +22,13 @@ Context::GetTraceContext() const {
     return trace_context_;
 }
 
+void
+Context::RecordSpan(const std::string& operation_name, const std::chrono::system_clock::time_point& start_time) const {
+    if (trace_context_) {
+        trace_context_->Record(operation_name, start_time);
+    }
+}
+
 void
 Context::SetTraceContext(const std::shared_ptr<tracing::TraceContext>& trace_context) {
     trace_context_ = trace_context;
@@ -30,6 +37,7 @@ std::shared_ptr<Context>
 Context::Child(const std::string& operation_name) const {
     auto new_context = std::make_shared<Context>(request_id_);
     new_context->SetTraceContext(trace_context_->Child(operation_name));
+    new_context->InheritFrom(*this);
     return new_context;
 }
 
@@ -37,6 +45,7 @@ std::shared_ptr<Context>
 Context::Follower(const std::string& operation_name) const {
     auto new_context = std::make_shared<Context>(request_id_);
     new_context->SetTraceContext(trace_context_->Follower(operation_name));
+    new_context->InheritFrom(*this);
     return new_context;
 }
 
@@ -54,6 +63,40 @@ Context::IsConnectionBroken() const {
     return context_->IsConnectionBroken();
 }
 
+void
+Context::SetDeadline(const std::chrono::system_clock::time_point& deadline) {
+    deadline_ = deadline;
+    has_deadline_ = true;
+}
+
+bool
+Context::HasDeadline() const {
+    return has_deadline_;
+}
+
+const std::chrono::system_clock::time_point&
+Context::Deadline() const {
+    return deadline_;
+}
+
+bool
+Context::IsDeadlineExceeded() const {
+    return has_deadline_ && std::chrono::system_clock::now() > deadline_;
+}
+
+bool
+Context::IsCanceled() const {
+    return IsDeadlineExceeded() || IsConnectionBroken();
+}
+
+void
+Context::InheritFrom(const Context& parent) {
+    context_ = parent.context_;
+    has_deadline_ = parent.has_deadline_;
+    deadline_ = parent.deadline_;
+    stage_timer_ = parent.stage_timer_;
+}
+
 BaseRequest::RequestType
 Context::GetRequestType() const {
     return request_type_;
@@ -64,6 +107,16 @@ Context::SetRequestType(BaseRequest::RequestType type) {
     request_type_ = type;
 }
 
+void
+Context::SetStageTimer(const StageTimerPtr& stage_timer) {
+    stage_timer_ = stage_timer;
+}
+
+const StageTimerPtr&
+Context::GetStageTimer() const {
+    return stage_timer_;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 ContextChild::ContextChild(const ContextPtr& context, const std::string& operation_name) {
     if (context) {
@@ -83,6 +136,13 @@ ContextChild::Finish() {
     }
 }
 
+void
+ContextChild::SetTag(const std::string& key, const opentracing::Value& value) {
+    if (context_) {
+        context_->GetTraceContext()->GetSpan()->SetTag(key, value);
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 ContextFollower::ContextFollower(const ContextPtr& context, const std::string& operation_name) {
     if (context) {
@@ -104,5 +164,33 @@ ContextFollower::Finish() {
     }
 }
 
+void
+ContextFollower::SetTag(const std::string& key, const opentracing::Value& value) {
+    if (context_) {
+        context_->GetTraceContext()->GetSpan()->SetTag(key, value);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+ContextStage::ContextStage(const ContextPtr& context, SearchStage stage)
+    : stage_(stage), start_(std::chrono::steady_clock::now()) {
+    if (context) {
+        stage_timer_ = context->GetStageTimer();
+    }
+}
+
+ContextStage::~ContextStage() {
+    Finish();
+}
+
+void
+ContextStage::Finish() {
+    if (stage_timer_) {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        stage_timer_->Add(stage_, std::chrono::duration<double, std::micro>(elapsed).count());
+        stage_timer_ = nullptr;
+    }
+}
+
 }  // namespace server
 }  // namespace milvus
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -18,6 +19,7 @@
 #include <grpcpp/server_context.h>
 
 #include "server/context/ConnectionContext.h"
+#include "server/context/StageTimer.h"
 #include "server/delivery/request/BaseRequest.h"
 #include "tracing/TraceContext.h"
 
@@ -45,23 +47,58 @@ class Context {
     const std::shared_ptr<tracing::TraceContext>&
     GetTraceContext() const;
 
+    // a finished span of a stage not wrapped by ContextChild, such as queue wait
+    void
+    RecordSpan(const std::string& operation_name, const std::chrono::system_clock::time_point& start_time) const;
+
     void
     SetConnectionContext(ConnectionContextPtr& context);
 
     bool
     IsConnectionBroken() const;
 
+    void
+    SetDeadline(const std::chrono::system_clock::time_point& deadline);
+
+    bool
+    HasDeadline() const;
+
+    const std::chrono::system_clock::time_point&
+    Deadline() const;
+
+    bool
+    IsDeadlineExceeded() const;
+
+    // the client is gone or its deadline is exceeded, no need to continue the work
+    bool
+    IsCanceled() const;
+
     BaseRequest::RequestType
     GetRequestType() const;
 
     void
     SetRequestType(BaseRequest::RequestType type);
 
+    // shared by child and follower contexts, so every stage of one request goes to the same timer
+    void
+    SetStageTimer(const StageTimerPtr& stage_timer);
+
+    const StageTimerPtr&
+    GetStageTimer() const;
+
+ private:
+    // child and follower contexts are canceled together with their parent and share its stage timer
+    void
+    InheritFrom(const Context& parent);
+
  private:
     std::string request_id_;
     BaseRequest::RequestType request_type_;
     std::shared_ptr<tracing::TraceContext> trace_context_;
     ConnectionContextPtr context_;
+    bool has_deadline_ = false;
+    std::chrono::system_clock::time_point deadline_;
+    StageTimerPtr stage_timer_;
 };
 
 using ContextPtr = std::shared_ptr<milvus::server::Context>;
@@ -79,6 +116,9 @@ class ContextChild {
     void
     Finish();
 
+    void
+    SetTag(const std::string& key, const opentracing::Value& value);
+
  private:
     ContextPtr context_;
 };
@@ -96,9 +136,27 @@ class ContextFollower {
     void
     Finish();
 
+    void
+    SetTag(const std::string& key, const opentracing::Value& value);
+
  private:
     ContextPtr context_;
 };
 
+// add the elapsed time to a stage of the context's stage timer, no-op if the context has no timer
+class ContextStage {
+ public:
+    ContextStage(const ContextPtr& context, SearchStage stage);
+    ~ContextStage();
+
+    void
+    Finish();
+
+ private:
+    StageTimerPtr stage_timer_;
+    SearchStage stage_;
+    std::chrono::steady_clock::time_point start_;
+};
+
 }  // namespace server
 }  // namespace milvus
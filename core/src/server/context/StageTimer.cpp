@@ -0,0 +1,127 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/context/StageTimer.h"
+
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#include "metrics/CollectionAccounting.h"
+
+namespace milvus {
+namespace server {
+
+StageTimer::StageTimer(bool sampled) : sampled_(sampled), observed_(false) {
+    for (auto& value : microseconds_) {
+        value = 0;
+    }
+}
+
+bool
+StageTimer::Sample(float rate) {
+    if (rate <= 0.0) {
+        return false;
+    }
+    thread_local std::mt19937 generator(std::random_device{}());
+    std::uniform_real_distribution<float> distribution(0.0, 1.0);
+    return distribution(generator) < rate;
+}
+
+const char*
+StageTimer::StageName(SearchStage stage) {
+    switch (stage) {
+        case SearchStage::QUEUE:
+            return "queue";
+        case SearchStage::META:
+            return "meta";
+        case SearchStage::OPTIMIZE:
+            return "optimize";
+        case SearchStage::LOAD:
+            return "load";
+        case SearchStage::SEARCH:
+            return "search";
+        case SearchStage::REDUCE:
+            return "reduce";
+        case SearchStage::SERIALIZE:
+            return "serialize";
+        default:
+            return "unknown";
+    }
+}
+
+void
+StageTimer::Add(SearchStage stage, double microseconds) {
+    microseconds_[static_cast<size_t>(stage)] += static_cast<int64_t>(microseconds);
+}
+
+double
+StageTimer::Get(SearchStage stage) const {
+    return static_cast<double>(microseconds_[static_cast<size_t>(stage)].load());
+}
+
+void
+StageTimer::SetLabels(const std::string& collection, const std::string& index_type) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    collection_ = collection;
+    index_type_ = index_type;
+}
+
+void
+StageTimer::Observe() {
+    if (observed_.exchange(true)) {
+        return;
+    }
+
+    std::string collection, index_type;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        collection = collection_;
+        index_type = index_type_;
+    }
+
+    // collections outside the top n share one label, so the series count stays bounded
+    std::vector<std::pair<std::string, double>> stages;
+    for (size_t i = 0; i < microseconds_.size(); ++i) {
+        auto stage = static_cast<SearchStage>(i);
+        stages.emplace_back(StageName(stage), Get(stage));
+    }
+    CollectionAccounting::GetInstance().AddSearchStages(collection, index_type, stages);
+}
+
+std::string
+StageTimer::ToString() const {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < microseconds_.size(); ++i) {
+        auto stage = static_cast<SearchStage>(i);
+        if (i > 0) {
+            ss << " ";
+        }
+        ss << StageName(stage) << "=" << Get(stage) / 1000 << "ms";
+    }
+    return ss.str();
+}
+
+void
+StageTimer::AddTask(const TaskProfile& task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(task);
+}
+
+std::vector<TaskProfile>
+StageTimer::Tasks() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_;
+}
+
+}  // namespace server
+}  // namespace milvus
@@ -0,0 +1,101 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace server {
+
+enum class SearchStage {
+    QUEUE = 0,  // wait in the request queue
+    META,       // collect files to search from meta
+    OPTIMIZE,   // scheduler optimizer passes and path calculation
+    LOAD,       // load index files to the search resource
+    SEARCH,     // search index files
+    REDUCE,     // merge the results of index files
+    SERIALIZE,  // construct the response
+    COUNT,
+};
+
+// how one search task went, kept for the slow query log
+struct TaskProfile {
+    int64_t file_id_ = 0;
+    std::string segment_id_;
+    int32_t file_type_ = 0;
+    std::string resource_;
+    double load_us_ = 0;
+    double execute_us_ = 0;
+    bool cache_hit_ = false;
+    int64_t bytes_read_ = 0;
+};
+
+// Time a search request spends in each stage. Tasks of one request run in parallel, so load, search and
+// reduce sum the time of all tasks.
+class StageTimer {
+ public:
+    explicit StageTimer(bool sampled = false);
+
+    // decide whether a request is sampled, the rate is a ratio in [0, 1]
+    static bool
+    Sample(float rate);
+
+    static const char*
+    StageName(SearchStage stage);
+
+    void
+    Add(SearchStage stage, double microseconds);
+
+    double
+    Get(SearchStage stage) const;
+
+    void
+    SetLabels(const std::string& collection, const std::string& index_type);
+
+    bool
+    Sampled() const {
+        return sampled_;
+    }
+
+    // export the stages to per-stage histograms, only the first call takes effect
+    void
+    Observe();
+
+    std::string
+    ToString() const;
+
+    void
+    AddTask(const TaskProfile& task);
+
+    std::vector<TaskProfile>
+    Tasks() const;
+
+ private:
+    std::array<std::atomic<int64_t>, static_cast<size_t>(SearchStage::COUNT)> microseconds_;
+    bool sampled_;
+    std::atomic<bool> observed_;
+
+    mutable std::mutex mutex_;
+    std::string collection_;
+    std::string index_type_;
+    std::vector<TaskProfile> tasks_;
+};
+
+using StageTimerPtr = std::shared_ptr<StageTimer>;
+
+}  // namespace server
+}  // namespace milvus
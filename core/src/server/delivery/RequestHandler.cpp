@@ -37,6 +37,7 @@
 #include "server/delivery/request/ReLoadSegmentsRequest.h"
 #include "server/delivery/request/ReleaseCollectionRequest.h"
 #include "server/delivery/request/SearchByIDRequest.h"
+#include "server/delivery/request/SearchMultiRequest.h"
 #include "server/delivery/request/SearchRequest.h"
 #include "server/delivery/request/ShowCollectionInfoRequest.h"
 #include "server/delivery/request/ShowCollectionsRequest.h"
@@ -138,6 +139,28 @@ RequestHandler::Search(const std::shared_ptr<Context>& context, const std::strin
     return request_ptr->status();
 }
 
+Status
+RequestHandler::SearchAsync(const std::shared_ptr<Context>& context, const std::string& collection_name,
+                            const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
+                            const std::vector<std::string>& partition_list,
+                            const std::vector<std::string>& file_id_list, TopKQueryResult& result,
+                            const BaseRequest::DoneCallback& callback) {
+    BaseRequestPtr request_ptr = SearchRequest::Create(context, collection_name, vectors, topk, extra_params,
+                                                       partition_list, file_id_list, result);
+    request_ptr->SetDoneCallback(callback);
+    RequestScheduler::ExecRequest(request_ptr);
+
+    return Status::OK();
+}
+
+Status
+RequestHandler::SearchMulti(const std::shared_ptr<Context>& context, std::vector<engine::CollectionQuery>& queries) {
+    BaseRequestPtr request_ptr = SearchMultiRequest::Create(context, queries);
+    RequestScheduler::ExecRequest(request_ptr);
+
+    return request_ptr->status();
+}
+
 Status
 RequestHandler::SearchByID(const std::shared_ptr<Context>& context, const std::string& collection_name,
                            const std::vector<int64_t>& id_array, int64_t topk, const milvus::json& extra_params,
@@ -68,6 +68,17 @@ class RequestHandler {
            const std::vector<std::string>& partition_list, const std::vector<std::string>& file_id_list,
            TopKQueryResult& result);
 
+    // return once the request is queued, result must be kept alive until the callback is invoked
+    Status
+    SearchAsync(const std::shared_ptr<Context>& context, const std::string& collection_name,
+                const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
+                const std::vector<std::string>& partition_list, const std::vector<std::string>& file_id_list,
+                TopKQueryResult& result, const BaseRequest::DoneCallback& callback);
+
+    // search several collections in one request, results and status are filled into each query
+    Status
+    SearchMulti(const std::shared_ptr<Context>& context, std::vector<engine::CollectionQuery>& queries);
+
     Status
     SearchByID(const std::shared_ptr<Context>& context, const std::string& collection_name,
                const std::vector<int64_t>& id_array, int64_t topk, const milvus::json& extra_params,
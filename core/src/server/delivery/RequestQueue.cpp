@@ -16,7 +16,7 @@
 
 #include <fiu-local.h>
 #include <unistd.h>
-#include <queue>
+#include <deque>
 #include <utility>
 
 namespace milvus {
@@ -24,14 +24,14 @@ namespace server {
 
 namespace {
 Status
-ScheduleRequest(const BaseRequestPtr& request, std::queue<BaseRequestPtr>& queue) {
+ScheduleRequest(const BaseRequestPtr& request, std::deque<BaseRequestPtr>& queue) {
 #if 1
     if (request == nullptr) {
         return Status(SERVER_NULL_POINTER, "request schedule cannot handle null object");
     }
 
     if (queue.empty()) {
-        queue.push(request);
+        queue.push_back(request);
         return Status::OK();
     }
 
@@ -40,12 +40,12 @@ ScheduleRequest(const BaseRequestPtr& request, std::queue<BaseRequestPtr>& queue
 
     auto iter = s_schedulers.find(request->GetRequestType());
     if (iter == s_schedulers.end() || iter->second == nullptr) {
-        queue.push(request);
+        queue.push_back(request);
     } else {
         iter->second->ReScheduleQueue(request, queue);
     }
 #else
-    queue.push(request);
+    queue.push_back(request);
 #endif
 
     return Status::OK();
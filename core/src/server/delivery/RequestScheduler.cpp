@@ -10,6 +10,10 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "server/delivery/RequestScheduler.h"
+#include "config/Config.h"
+#include "metrics/Metrics.h"
+#include "server/context/Context.h"
+#include "utils/CommonUtil.h"
 #include "utils/Log.h"
 
 #include <fiu-local.h>
@@ -19,6 +23,11 @@
 namespace milvus {
 namespace server {
 
+namespace {
+// share of the dql memory limit the large query lane can't use, so that large queries never block the small ones
+constexpr double DQL_SMALL_RESERVED_MEMORY_RATIO = 0.25;
+}  // namespace
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 RequestScheduler::RequestScheduler() : stopped_(false) {
     Start();
@@ -58,7 +67,10 @@ RequestScheduler::Stop() {
         std::lock_guard<std::mutex> lock(queue_mtx_);
         for (auto& iter : request_groups_) {
             if (iter.second != nullptr) {
-                iter.second->Put(nullptr);
+                // each executor of the group takes one null request and exits
+                for (int64_t i = 0; i < group_executor_num_[iter.first]; ++i) {
+                    iter.second->Put(nullptr);
+                }
             }
         }
     }
@@ -69,6 +81,7 @@ RequestScheduler::Stop() {
         iter->join();
     }
     request_groups_.clear();
+    group_executor_num_.clear();
     execute_threads_.clear();
     stopped_ = true;
     LOG_SERVER_INFO_ << "Scheduler stopped";
@@ -86,11 +99,13 @@ RequestScheduler::ExecuteRequest(const BaseRequestPtr& request_ptr) {
         return status;
     }
 
+    request_ptr->SetQueuedTime(std::chrono::system_clock::now());
     status = PutToQueue(request_ptr);
     fiu_do_on("RequestScheduler.ExecuteRequest.push_queue_fail", status = Status(SERVER_INVALID_ARGUMENT, ""));
 
     if (!status.ok()) {
         LOG_SERVER_ERROR_ << "Put request to queue failed with code: " << status.ToString();
+        request_ptr->set_status(status);
         request_ptr->Done();
         return status;
     }
@@ -108,7 +123,7 @@ RequestScheduler::ExecuteRequest(const BaseRequestPtr& request_ptr) {
 }
 
 void
-RequestScheduler::TakeToExecute(RequestQueuePtr request_queue) {
+RequestScheduler::TakeToExecute(const std::string& group_name, RequestQueuePtr request_queue) {
     SetThreadName("reqsched_thread");
     if (request_queue == nullptr) {
         return;
@@ -121,6 +136,26 @@ RequestScheduler::TakeToExecute(RequestQueuePtr request_queue) {
             break;  // stop the thread
         }
 
+        double wait_time = METRICS_MICROSECONDS(request->QueuedTime(), METRICS_NOW_TIME);
+        Metrics::GetInstance().RequestQueueWaitDurationHistogramObserve(wait_time);
+        if (request->Context() != nullptr && request->Context()->GetStageTimer() != nullptr) {
+            request->Context()->GetStageTimer()->Add(SearchStage::QUEUE, wait_time);
+        }
+
+        // the client has given up, drop the request so that the live ones get the resources
+        if (request->IsCanceled()) {
+            int64_t wait_ms = static_cast<int64_t>(wait_time / 1000);
+            std::string msg = "Request canceled after waiting " + std::to_string(wait_ms) +
+                              " ms in queue, the client deadline is exceeded or the connection is broken";
+            request->set_status(Status(SERVER_REQUEST_CANCELED, msg));
+            request->Done();
+            Metrics::GetInstance().RequestExpiredTotalIncrement();
+            continue;
+        }
+
+        int64_t memory = request->EstimateMemory();
+        AdmitRequest(group_name, memory);
+
         try {
             fiu_do_on("RequestScheduler.TakeToExecute.throw_std_exception1", throw std::exception());
             auto status = request->Execute();
@@ -132,6 +167,8 @@ RequestScheduler::TakeToExecute(RequestQueuePtr request_queue) {
         } catch (std::exception& ex) {
             LOG_SERVER_ERROR_ << "Request failed to execute: " << ex.what();
         }
+
+        ReleaseRequest(group_name, memory);
     }
 }
 
@@ -139,7 +176,7 @@ Status
 RequestScheduler::PutToQueue(const BaseRequestPtr& request_ptr) {
     std::lock_guard<std::mutex> lock(queue_mtx_);
 
-    std::string group_name = request_ptr->RequestGroup();
+    std::string group_name = SelectRequestGroup(request_ptr);
     if (request_groups_.count(group_name) > 0) {
         request_groups_[group_name]->PutRequest(request_ptr);
     } else {
@@ -148,16 +185,106 @@ RequestScheduler::PutToQueue(const BaseRequestPtr& request_ptr) {
         request_groups_.insert(std::make_pair(group_name, queue));
         fiu_do_on("RequestScheduler.PutToQueue.null_queue", queue = nullptr);
 
-        // start a thread
-        ThreadPtr thread = std::make_shared<std::thread>(&RequestScheduler::TakeToExecute, this, queue);
+        // start executor threads, all of them take requests from the same queue
+        int64_t executor_num = GroupExecutorNum(group_name);
+        group_executor_num_[group_name] = executor_num;
+        for (int64_t i = 0; i < executor_num; ++i) {
+            ThreadPtr thread = std::make_shared<std::thread>(&RequestScheduler::TakeToExecute, this, group_name, queue);
 
-        fiu_do_on("RequestScheduler.PutToQueue.push_null_thread", execute_threads_.push_back(nullptr));
-        execute_threads_.push_back(thread);
-        LOG_SERVER_INFO_ << "Create new thread for request group: " << group_name;
+            fiu_do_on("RequestScheduler.PutToQueue.push_null_thread", execute_threads_.push_back(nullptr));
+            execute_threads_.push_back(thread);
+        }
+        LOG_SERVER_INFO_ << "Create " << executor_num << " threads for request group: " << group_name;
     }
 
     return Status::OK();
 }
 
+std::string
+RequestScheduler::SelectRequestGroup(const BaseRequestPtr& request_ptr) {
+    std::string group_name = request_ptr->RequestGroup();
+    if (group_name != DQL_REQUEST_GROUP) {
+        return group_name;
+    }
+
+    // expensive queries go to a separate lane so that they never block the small ones
+    int64_t threshold = 0;
+    Config::GetInstance().GetEngineConfigDqlLargeQueryThreshold(threshold);
+    if (threshold > 0 && request_ptr->EstimateCost() >= threshold) {
+        return DQL_LARGE_REQUEST_GROUP;
+    }
+
+    return group_name;
+}
+
+int64_t
+RequestScheduler::GroupExecutorNum(const std::string& group_name) {
+    int64_t executor_num = 1;
+    auto& config = Config::GetInstance();
+    if (group_name == DQL_REQUEST_GROUP) {
+        config.GetEngineConfigDqlExecutorNum(executor_num);
+    } else if (group_name == DQL_LARGE_REQUEST_GROUP) {
+        config.GetEngineConfigDqlLargeExecutorNum(executor_num);
+    }
+
+    return executor_num;
+}
+
+void
+RequestScheduler::AdmitRequest(const std::string& group_name, int64_t memory) {
+    if (memory <= 0) {
+        return;
+    }
+
+    int64_t memory_limit = 0;
+    Config::GetInstance().GetEngineConfigDqlMemoryLimit(memory_limit);
+
+    std::unique_lock<std::mutex> lock(admission_mtx_);
+    auto admissible = [&]() -> bool {
+        // always admit one request of each group, otherwise a huge request could never be executed
+        if (admitted_memory_[group_name] == 0) {
+            return true;
+        }
+
+        int64_t limit = memory_limit;
+        if (limit <= 0) {
+            // no explicit limit, allow executing requests to use half of the free memory
+            int64_t total_mem = 0, free_mem = 0;
+            CommonUtil::GetSystemMemInfo(total_mem, free_mem);
+            limit = free_mem / 2;
+        }
+        if (group_name == DQL_LARGE_REQUEST_GROUP) {
+            limit = static_cast<int64_t>(limit * (1.0 - DQL_SMALL_RESERVED_MEMORY_RATIO));
+        }
+
+        int64_t admitted = 0;
+        for (auto& pair : admitted_memory_) {
+            admitted += pair.second;
+        }
+        return admitted + memory <= limit;
+    };
+
+    if (!admissible()) {
+        LOG_SERVER_DEBUG_ << "Request of " << group_name << " delayed by admission control, estimated memory: "
+                          << memory << " bytes, admitted memory of the group: " << admitted_memory_[group_name]
+                          << " bytes";
+        admission_cv_.wait(lock, admissible);
+    }
+    admitted_memory_[group_name] += memory;
+}
+
+void
+RequestScheduler::ReleaseRequest(const std::string& group_name, int64_t memory) {
+    if (memory <= 0) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(admission_mtx_);
+        admitted_memory_[group_name] -= memory;
+    }
+    admission_cv_.notify_all();
+}
+
 }  // namespace server
 }  // namespace milvus
@@ -14,6 +14,7 @@
 #include "server/delivery/RequestQueue.h"
 #include "utils/Status.h"
 
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <string>
@@ -51,18 +52,37 @@ class RequestScheduler {
     virtual ~RequestScheduler();
 
     void
-    TakeToExecute(RequestQueuePtr request_queue);
+    TakeToExecute(const std::string& group_name, RequestQueuePtr request_queue);
 
     Status
     PutToQueue(const BaseRequestPtr& request_ptr);
 
+    std::string
+    SelectRequestGroup(const BaseRequestPtr& request_ptr);
+
+    int64_t
+    GroupExecutorNum(const std::string& group_name);
+
+    // the large query lane may not use the share of the memory limit reserved for the small queries
+    void
+    AdmitRequest(const std::string& group_name, int64_t memory);
+
+    void
+    ReleaseRequest(const std::string& group_name, int64_t memory);
+
  private:
     mutable std::mutex queue_mtx_;
 
     std::map<std::string, RequestQueuePtr> request_groups_;
+    std::map<std::string, int64_t> group_executor_num_;
 
     std::vector<ThreadPtr> execute_threads_;
 
+    // admission control, estimated memory of the executing dql requests of each group
+    std::mutex admission_mtx_;
+    std::condition_variable admission_cv_;
+    std::map<std::string, int64_t> admitted_memory_;
+
     bool stopped_;
 };
 
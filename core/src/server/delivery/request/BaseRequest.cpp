@@ -13,6 +13,8 @@
 
 #include <map>
 
+#include "metrics/CollectionAccounting.h"
+#include "server/SlowQueryLog.h"
 #include "server/context/Context.h"
 #include "utils/CommonUtil.h"
 #include "utils/Exception.h"
@@ -21,9 +23,10 @@
 namespace milvus {
 namespace server {
 
-static const char* DQL_REQUEST_GROUP = "dql";
-static const char* DDL_DML_REQUEST_GROUP = "ddl_dml";
-static const char* INFO_REQUEST_GROUP = "info";
+const char* DQL_REQUEST_GROUP = "dql";
+const char* DQL_LARGE_REQUEST_GROUP = "dql_large";
+const char* DDL_DML_REQUEST_GROUP = "ddl_dml";
+const char* INFO_REQUEST_GROUP = "info";
 
 namespace {
 std::string
@@ -66,6 +69,7 @@ RequestGroup(BaseRequest::RequestType type) {
         {BaseRequest::kSearchByID, DQL_REQUEST_GROUP},
         {BaseRequest::kSearch, DQL_REQUEST_GROUP},
         {BaseRequest::kSearchCombine, DQL_REQUEST_GROUP},
+        {BaseRequest::kSearchMulti, DQL_REQUEST_GROUP},
     };
 
     auto iter = s_map_type_group.find(type);
@@ -101,7 +105,19 @@ BaseRequest::PreExecute() {
 
 Status
 BaseRequest::Execute() {
+    if (context_ != nullptr && queued_time_ != std::chrono::system_clock::time_point()) {
+        context_->RecordSpan("Request queue wait", queued_time_);
+    }
+
     status_ = OnExecute();
+
+    // record before Done(), the caller may release the objects referenced by the request once it is done,
+    // requests executed without the queue have no queued time and are not recorded
+    if (request_group_ == DQL_REQUEST_GROUP && queued_time_ != std::chrono::system_clock::time_point()) {
+        auto total_us = std::chrono::duration<double, std::micro>(std::chrono::system_clock::now() - queued_time_);
+        SlowQueryLog::GetInstance().Record(*this, total_us.count());
+    }
+
     Done();
     return status_;
 }
@@ -124,9 +140,33 @@ BaseRequest::OnPostExecute() {
 
 void
 BaseRequest::Done() {
+    // combined search requests are done without being executed, so the accounting is done here
+    if (request_group_ == DQL_REQUEST_GROUP && queued_time_ != std::chrono::system_clock::time_point() &&
+        status_.ok()) {
+        auto total_us = std::chrono::duration<double, std::micro>(std::chrono::system_clock::now() - queued_time_);
+        for (auto& collection : Collections()) {
+            CollectionAccounting::GetInstance().AddSearch(collection, total_us.count());
+        }
+    }
+
+    DoneCallback callback;
+    {
+        std::unique_lock<std::mutex> lock(finish_mtx_);
+        done_ = true;
+        finish_cond_.notify_all();
+        callback.swap(done_callback_);
+    }
+
+    if (callback) {
+        callback(status_);
+    }
+}
+
+void
+BaseRequest::SetDoneCallback(const DoneCallback& callback) {
     std::unique_lock<std::mutex> lock(finish_mtx_);
-    done_ = true;
-    finish_cond_.notify_all();
+    done_callback_ = callback;
+    async_ = true;
 }
 
 void
@@ -151,6 +191,18 @@ BaseRequest::PartitionNotExistMsg(const std::string& collection_name, const std:
            "You also can check whether the partition name exists.";
 }
 
+int64_t
+BaseRequest::EstimateSearchMemory(int64_t nq, int64_t topk) {
+    // search job result, task output and merge buffer are alive at the same time
+    constexpr int64_t RESULT_BUFFER_COPIES = 3;
+    return nq * topk * static_cast<int64_t>(sizeof(int64_t) + sizeof(float)) * RESULT_BUFFER_COPIES;
+}
+
+bool
+BaseRequest::IsCanceled() const {
+    return context_ != nullptr && context_->IsCanceled();
+}
+
 Status
 BaseRequest::WaitToFinish() {
     std::unique_lock<std::mutex> lock(finish_mtx_);
@@ -20,7 +20,9 @@
 #include "utils/Json.h"
 #include "utils/Status.h"
 
+#include <chrono>
 #include <condition_variable>
+#include <functional>
 //#include <gperftools/profiler.h>
 #include <memory>
 #include <string>
@@ -102,6 +104,11 @@ struct PartitionParam {
     }
 };
 
+extern const char* DQL_REQUEST_GROUP;
+extern const char* DQL_LARGE_REQUEST_GROUP;
+extern const char* DDL_DML_REQUEST_GROUP;
+extern const char* INFO_REQUEST_GROUP;
+
 class Context;
 
 class BaseRequest {
@@ -144,8 +151,11 @@ class BaseRequest {
         kSearchByID = 600,
         kSearch,
         kSearchCombine,
+        kSearchMulti,
     };
 
+    using DoneCallback = std::function<void(const Status& status)>;
+
  protected:
     BaseRequest(const std::shared_ptr<milvus::server::Context>& context, BaseRequest::RequestType type,
                 bool async = false);
@@ -191,6 +201,47 @@ class BaseRequest {
         return async_;
     }
 
+    // execute the request asynchronously, the callback is invoked with the final status once the request is done
+    void
+    SetDoneCallback(const DoneCallback& callback);
+
+    // the client has given up or its deadline is exceeded, the request result is useless
+    bool
+    IsCanceled() const;
+
+    void
+    SetQueuedTime(const std::chrono::system_clock::time_point& time) {
+        queued_time_ = time;
+    }
+
+    const std::chrono::system_clock::time_point&
+    QueuedTime() const {
+        return queued_time_;
+    }
+
+    // estimated computation cost, dql requests whose cost exceed threshold run in the large query lane
+    virtual int64_t
+    EstimateCost() const {
+        return 0;
+    }
+
+    // estimated bytes held by the request during execution, used by admission control
+    virtual int64_t
+    EstimateMemory() const {
+        return 0;
+    }
+
+    // request parameters for the slow query log, vectors are left out
+    virtual void
+    DescribeParams(milvus::json& params) const {
+    }
+
+    // collections the request is accounted to in per-collection resource accounting
+    virtual std::vector<std::string>
+    Collections() const {
+        return {};
+    }
+
  protected:
     virtual Status
     OnPreExecute();
@@ -207,18 +258,23 @@ class BaseRequest {
     std::string
     PartitionNotExistMsg(const std::string& collection_name, const std::string& partition_tag);
 
+    static int64_t
+    EstimateSearchMemory(int64_t nq, int64_t topk);
+
  protected:
     const std::shared_ptr<milvus::server::Context> context_;
 
     RequestType type_;
     std::string request_group_;
     bool async_;
+    std::chrono::system_clock::time_point queued_time_;
 
  private:
     mutable std::mutex finish_mtx_;
     std::condition_variable finish_cond_;
     bool done_;
     Status status_;
+    DoneCallback done_callback_;
 
  public:
     const std::shared_ptr<milvus::server::Context>&
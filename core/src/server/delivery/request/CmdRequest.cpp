@@ -10,17 +10,60 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "server/delivery/request/CmdRequest.h"
+#include "cache/CpuCacheMgr.h"
 #include "config/Config.h"
+#include "metrics/CollectionAccounting.h"
 #include "metrics/SystemInfo.h"
 #include "scheduler/SchedInst.h"
+#include "server/DBWrapper.h"
+#include "server/SlowQueryLog.h"
 #include "utils/Log.h"
+#include "utils/StringHelpFunctions.h"
 #include "utils/TimeRecorder.h"
+#include "utils/ValidationUtil.h"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace milvus {
 namespace server {
 
+namespace {
+// cache items listed by the "cache" command, most recently used first
+constexpr int64_t CACHE_DUMP_ITEM_LIMIT = 1000;
+
+// "auto_tune <collection>" shows the tuned search param of the collection,
+// "auto_tune <collection> <target_recall> <latency_slo_ms>" sets its targets
+Status
+AutoTune(const std::string& cmd, std::string& result) {
+    std::vector<std::string> words;
+    StringHelpFunctions::SplitStringByDelimeter(cmd, " ", words);
+    words.erase(std::remove(words.begin(), words.end(), ""), words.end());
+    if (words.size() != 2 && words.size() != 4) {
+        return Status(SERVER_INVALID_ARGUMENT, "Usage: auto_tune <collection> [<target_recall> <latency_slo_ms>]");
+    }
+
+    auto& collection_name = words[1];
+    STATUS_CHECK(ValidationUtil::ValidateCollectionName(collection_name));
+    if (words.size() == 4) {
+        if (!ValidationUtil::ValidateStringIsFloat(words[2]).ok() || std::stof(words[2]) < 0.0 ||
+            std::stof(words[2]) > 1.0) {
+            return Status(SERVER_INVALID_ARGUMENT, "Invalid target recall: " + words[2]);
+        }
+        if (!ValidationUtil::ValidateStringIsNumber(words[3]).ok()) {
+            return Status(SERVER_INVALID_ARGUMENT, "Invalid latency slo: " + words[3]);
+        }
+        STATUS_CHECK(DBWrapper::DB()->SetSearchTuneTarget(collection_name, std::stof(words[2]), std::stoll(words[3])));
+    }
+
+    milvus::json status;
+    STATUS_CHECK(DBWrapper::DB()->GetSearchTuneStatus(collection_name, status));
+    result = status.dump();
+    return Status::OK();
+}
+}  // namespace
+
 CmdRequest::CmdRequest(const std::shared_ptr<milvus::server::Context>& context, const std::string& cmd,
                        std::string& result)
     : BaseRequest(context, BaseRequest::kCmd), cmd_(cmd), result_(result) {
@@ -44,6 +87,28 @@ CmdRequest::OnExecute() {
         result_ = "OK";
     } else if (cmd_ == "tasktable") {
         result_ = scheduler::ResMgrInst::GetInstance()->DumpTaskTables();
+    } else if (cmd_ == "scheduler") {
+        auto res_mgr = scheduler::ResMgrInst::GetInstance();
+        auto build_mgr = scheduler::BuildMgrInst::GetInstance();
+        milvus::json ret{
+            {"resources", res_mgr->DumpTaskTableStates()},
+            {"jobs", res_mgr->DumpJobProgress()},
+            {"job_mgr", scheduler::JobMgrInst::GetInstance()->Dump()},
+            {"build_slots", {{"total", build_mgr->NumOfSlots()}, {"available", build_mgr->NumOfAvailable()}}},
+        };
+        result_ = ret.dump();
+    } else if (cmd_ == "cache") {
+        result_ = cache::CpuCacheMgr::GetInstance()->Dump(CACHE_DUMP_ITEM_LIMIT).dump();
+    } else if (cmd_ == "wal") {
+        milvus::json ret;
+        stat = DBWrapper::DB()->GetWalStatus(ret);
+        result_ = ret.dump();
+    } else if (cmd_ == "collections") {
+        int64_t top_n = 0;
+        stat = Config::GetInstance().GetMetricConfigCollectionTopN(top_n);
+        result_ = CollectionAccounting::GetInstance().Dump(top_n).dump();
+    } else if (cmd_.substr(0, 9) == "auto_tune") {
+        stat = AutoTune(cmd_, result_);
     } else if (cmd_ == "mode") {
 #ifdef MILVUS_GPU_VERSION
         result_ = "GPU";
@@ -55,6 +120,8 @@ CmdRequest::OnExecute() {
         sys_info_inst.GetSysInfoJsonStr(result_);
     } else if (cmd_ == "build_commit_id") {
         result_ = LAST_COMMIT_ID;
+    } else if (cmd_ == "slow_log") {
+        result_ = SlowQueryLog::GetInstance().Dump();
     } else if (cmd_.substr(0, 10) == "set_config" || cmd_.substr(0, 10) == "get_config") {
         server::Config& config = server::Config::GetInstance();
         stat = config.ProcessConfigCli(result_, cmd_);
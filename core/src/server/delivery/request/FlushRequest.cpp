@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "server/DBWrapper.h"
+#include "server/context/Context.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
@@ -51,6 +52,7 @@ FlushRequest::OnExecute() {
 
     // flush all collections
     if (collection_names_.empty()) {
+        milvus::server::ContextChild tracer(context_, "Flush");
         status = DBWrapper::DB()->Flush();
         return status;
     }
@@ -73,7 +75,10 @@ FlushRequest::OnExecute() {
             }
         }
 
+        milvus::server::ContextChild tracer(context_, "Flush");
+        tracer.SetTag("collection", name);
         status = DBWrapper::DB()->Flush(name);
+        tracer.Finish();
         if (!status.ok()) {
             return status;
         }
@@ -12,6 +12,7 @@
 #include "server/delivery/request/InsertRequest.h"
 #include "db/Utils.h"
 #include "server/DBWrapper.h"
+#include "server/context/Context.h"
 #include "utils/CommonUtil.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
@@ -154,7 +155,13 @@ InsertRequest::OnExecute() {
         auto vec_count = static_cast<uint64_t>(vector_count);
 
         rc.RecordSection("prepare vectors data");
+        // the vectors go to the insert buffer directly if wal is disabled
+        milvus::server::ContextChild wal_tracer(context_, "WAL append");
+        wal_tracer.SetTag("row_count", static_cast<uint64_t>(vector_count));
+        wal_tracer.SetTag("bytes", static_cast<uint64_t>(vectors_data_.float_data_.size() * sizeof(float) +
+                                                         vectors_data_.binary_data_.size()));
         status = DBWrapper::DB()->InsertVectors(collection_name_, partition_tag_, vectors_data_);
+        wal_tracer.Finish();
         fiu_do_on("InsertRequest.OnExecute.insert_fail", status = Status(milvus::SERVER_UNEXPECTED_ERROR, ""));
         if (!status.ok()) {
             LOG_SERVER_ERROR_ << LogOut("[%s][%ld] Insert fail: %s", "insert", 0, status.message().c_str());
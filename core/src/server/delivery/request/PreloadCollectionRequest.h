@@ -13,6 +13,7 @@
 
 #include "server/delivery/request/BaseRequest.h"
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -26,6 +27,12 @@ class PreloadCollectionRequest : public BaseRequest {
     Create(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
            const std::vector<std::string>& partition_tags);
 
+    int64_t
+    EstimateCost() const override {
+        // loading a whole collection is slow, never let it block the small query lane
+        return std::numeric_limits<int64_t>::max();
+    }
+
  protected:
     PreloadCollectionRequest(const std::shared_ptr<milvus::server::Context>& context,
                              const std::string& collection_name, const std::vector<std::string>& partition_tags);
@@ -54,6 +54,30 @@ SearchByIDRequest::Create(const std::shared_ptr<milvus::server::Context>& contex
         new SearchByIDRequest(context, collection_name, id_array, topk, extra_params, partition_list, result));
 }
 
+int64_t
+SearchByIDRequest::EstimateCost() const {
+    return static_cast<int64_t>(id_array_.size()) * topk_;
+}
+
+int64_t
+SearchByIDRequest::EstimateMemory() const {
+    return EstimateSearchMemory(id_array_.size(), topk_);
+}
+
+void
+SearchByIDRequest::DescribeParams(milvus::json& params) const {
+    params["collection_name"] = collection_name_;
+    params["partition_tags"] = partition_list_;
+    params["nq"] = id_array_.size();
+    params["topk"] = topk_;
+    params["params"] = extra_params_;
+}
+
+std::vector<std::string>
+SearchByIDRequest::Collections() const {
+    return {collection_name_};
+}
+
 Status
 SearchByIDRequest::OnExecute() {
     try {
@@ -98,7 +122,8 @@ SearchByIDRequest::OnExecute() {
             }
         }
 
-        // step 5: check search parameters
+        // step 5: check search parameters, the omitted ones are filled with the auto-tuned values
+        DBWrapper::DB()->FillSearchParams(collection_name_, collection_schema.engine_type_, topk_, extra_params_);
         status = ValidationUtil::ValidateSearchParams(extra_params_, collection_schema, topk_);
         if (!status.ok()) {
             return status;
@@ -33,6 +33,18 @@ class SearchByIDRequest : public BaseRequest {
            const std::vector<int64_t>& id_array, int64_t topk, const milvus::json& extra_params,
            const std::vector<std::string>& partition_list, TopKQueryResult& result);
 
+    int64_t
+    EstimateCost() const override;
+
+    int64_t
+    EstimateMemory() const override;
+
+    void
+    DescribeParams(milvus::json& params) const override;
+
+    std::vector<std::string>
+    Collections() const override;
+
  protected:
     SearchByIDRequest(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
                       const std::vector<int64_t>& id_array, int64_t topk, const milvus::json& extra_params,
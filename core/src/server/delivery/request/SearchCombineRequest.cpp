@@ -11,6 +11,7 @@
 
 #include "server/delivery/request/SearchCombineRequest.h"
 #include "db/Utils.h"
+#include "metrics/Metrics.h"
 #include "server/DBWrapper.h"
 #include "server/context/Context.h"
 #include "utils/CommonUtil.h"
@@ -18,6 +19,8 @@
 #include "utils/TimeRecorder.h"
 #include "utils/ValidationUtil.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
 #include <set>
 
@@ -26,7 +29,14 @@ namespace server {
 
 namespace {
 
-constexpr int64_t MAX_TOPK_GAP = 200;
+// the combined request searches with the max topk, the cost of a topk search grows with log(topk) while the
+// merge grows with topk, so a request pays at most this ratio of its own topk, whatever the absolute gap
+constexpr int64_t MAX_TOPK_RATIO = 16;
+
+bool
+WithinTopkRatio(int64_t min_topk, int64_t max_topk) {
+    return max_topk <= min_topk * MAX_TOPK_RATIO;
+}
 
 void
 GetUniqueList(const std::vector<std::string>& list, std::set<std::string>& unique_list) {
@@ -52,6 +62,27 @@ IsSameList(const std::set<std::string>& left, const std::set<std::string>& right
     return true;
 }
 
+// every combined request waits for the whole combined search, so each one is charged with all of its stages
+void
+ShareStages(const ContextPtr& combine_context, const SearchRequestPtr& request) {
+    if (combine_context == nullptr || request->Context() == nullptr) {
+        return;
+    }
+    auto& combine_timer = combine_context->GetStageTimer();
+    auto& stage_timer = request->Context()->GetStageTimer();
+    if (combine_timer == nullptr || stage_timer == nullptr) {
+        return;
+    }
+
+    for (auto stage : {SearchStage::META, SearchStage::OPTIMIZE, SearchStage::LOAD, SearchStage::SEARCH,
+                       SearchStage::REDUCE}) {
+        stage_timer->Add(stage, combine_timer->Get(stage));
+    }
+    for (auto& task : combine_timer->Tasks()) {
+        stage_timer->AddTask(task);
+    }
+}
+
 void
 FreeRequest(SearchRequestPtr& request, const Status& status) {
     request->set_status(status);
@@ -118,14 +149,8 @@ SearchCombineRequest::Combine(const SearchRequestPtr& request) {
 
         // assign base parameters
         collection_name_ = request->CollectionName();
-        min_topk_ = request->TopK() - MAX_TOPK_GAP / 2;
-        if (min_topk_ < 0) {
-            min_topk_ = 0;
-        }
-        max_topk_ = request->TopK() + MAX_TOPK_GAP / 2;
-        if (max_topk_ > QUERY_MAX_TOPK) {
-            max_topk_ = QUERY_MAX_TOPK;
-        }
+        min_topk_ = request->TopK();
+        max_topk_ = request->TopK();
         extra_params_ = request->ExtraParams();
 
         GetUniqueList(request->PartitionList(), partition_list_);
@@ -134,6 +159,8 @@ SearchCombineRequest::Combine(const SearchRequestPtr& request) {
 
     request_list_.push_back(request);
     vectors_data_.vector_count_ += request->VectorsData().vector_count_;
+    min_topk_ = std::min(min_topk_, request->TopK());
+    max_topk_ = std::max(max_topk_, request->TopK());
 
     return Status::OK();
 }
@@ -148,8 +175,9 @@ SearchCombineRequest::CanCombine(const SearchRequestPtr& request) {
         return false;
     }
 
-    // topk must within certain range
-    if (request->TopK() < min_topk_ || request->TopK() > max_topk_) {
+    // topk could be different, the combined request searches with the max topk and truncates result for each one,
+    // the max topk must be within a certain ratio of the min topk
+    if (!WithinTopkRatio(std::min(min_topk_, request->TopK()), std::max(max_topk_, request->TopK()))) {
         return false;
     }
 
@@ -189,8 +217,9 @@ SearchCombineRequest::CanCombine(const SearchRequestPtr& left, const SearchReque
         return false;
     }
 
-    // topk must within certain range
-    if (abs(left->TopK() - right->TopK() > MAX_TOPK_GAP)) {
+    // topk could be different, the combined request searches with the max topk and truncates result for each one,
+    // the larger topk must be within a certain ratio of the smaller one
+    if (!WithinTopkRatio(std::min(left->TopK(), right->TopK()), std::max(left->TopK(), right->TopK()))) {
         return false;
     }
 
@@ -222,6 +251,25 @@ SearchCombineRequest::CanCombine(const SearchRequestPtr& left, const SearchReque
     return true;
 }
 
+int64_t
+SearchCombineRequest::EstimateCost() const {
+    int64_t cost = 0;
+    for (auto& request : request_list_) {
+        cost += request->EstimateCost();
+    }
+    return cost;
+}
+
+int64_t
+SearchCombineRequest::EstimateMemory() const {
+    // combined requests are searched with the largest topk among them
+    int64_t topk = 0;
+    for (auto& request : request_list_) {
+        topk = std::max(topk, request->TopK());
+    }
+    return EstimateSearchMemory(vectors_data_.vector_count_, topk);
+}
+
 Status
 SearchCombineRequest::FreeRequests(const Status& status) {
     for (auto request : request_list_) {
@@ -235,17 +283,30 @@ Status
 SearchCombineRequest::OnExecute() {
     try {
         size_t combined_request = request_list_.size();
+        Metrics::GetInstance().SearchCombineBatchSizeHistogramObserve(combined_request);
         LOG_SERVER_DEBUG_ << "SearchCombineRequest execute, request count=" << combined_request
                           << ", extra_params=" << extra_params_.dump();
         std::string hdr = "SearchCombineRequest(collection=" + collection_name_ + ")";
 
         TimeRecorderAuto rc(hdr);
 
+        // the combined search is traced under the first request, its stages are timed once and shared by all,
+        // it doesn't inherit the cancellation of the first request since the others still wait for the result
+        ContextChild tracer(request_list_.empty() ? nullptr : request_list_.front()->Context(), "Combine Search");
+        ContextPtr combine_context;
+        if (tracer.Context() != nullptr) {
+            combine_context = std::make_shared<milvus::server::Context>(tracer.Context()->RequestID());
+            combine_context->SetTraceContext(tracer.Context()->GetTraceContext());
+            combine_context->SetStageTimer(std::make_shared<StageTimer>());
+        }
+
         // step 1: check collection existence
         // only process root collection, ignore partition collection
         engine::meta::CollectionSchema collection_schema;
         collection_schema.collection_id_ = collection_name_;
+        ContextStage meta_stage(combine_context, SearchStage::META);
         auto status = DBWrapper::DB()->DescribeCollection(collection_schema);
+        meta_stage.Finish();
 
         if (!status.ok()) {
             if (status.code() == DB_NOT_FOUND) {
@@ -264,11 +325,32 @@ SearchCombineRequest::OnExecute() {
             }
         }
 
-        // step 2: check input
+        auto index_type = engine::utils::GetIndexName(collection_schema.engine_type_);
+        for (auto& request : request_list_) {
+            if (request->Context() != nullptr && request->Context()->GetStageTimer() != nullptr) {
+                request->Context()->GetStageTimer()->SetLabels(collection_name_, index_type);
+            }
+        }
+
+        // step 2: check input, the omitted search parameters are filled with the auto-tuned values
+        int64_t max_topk = 0;
+        for (auto& request : request_list_) {
+            max_topk = std::max(max_topk, request->TopK());
+        }
+        DBWrapper::DB()->FillSearchParams(collection_name_, collection_schema.engine_type_, max_topk, extra_params_);
+
         size_t run_request = 0;
         std::vector<SearchRequestPtr>::iterator iter = request_list_.begin();
         for (; iter != request_list_.end();) {
             SearchRequestPtr& request = *iter;
+            if (request->IsCanceled()) {
+                // the client has given up, erase request to avoid searching for nothing
+                FreeRequest(request, Status(SERVER_REQUEST_CANCELED, "Request canceled before combined search"));
+                iter = request_list_.erase(iter);
+                Metrics::GetInstance().RequestExpiredTotalIncrement();
+                continue;
+            }
+
             status = ValidationUtil::ValidateSearchTopk(request->TopK());
             if (!status.ok()) {
                 // check failed, erase request and let it return error status
@@ -364,14 +446,19 @@ SearchCombineRequest::OnExecute() {
             context_list.CreateChild(request_list_, "Combine Query");
 
             if (file_id_list_.empty()) {
-                status = DBWrapper::DB()->Query(nullptr, collection_name_, partition_list, (size_t)search_topk_,
-                                                extra_params_, vectors_data_, result_ids, result_distances);
+                status = DBWrapper::DB()->Query(combine_context, collection_name_, partition_list,
+                                                (size_t)search_topk_, extra_params_, vectors_data_, result_ids,
+                                                result_distances);
             } else {
-                status = DBWrapper::DB()->QueryByFileID(nullptr, file_id_list, (size_t)search_topk_, extra_params_,
-                                                        vectors_data_, result_ids, result_distances);
+                status = DBWrapper::DB()->QueryByFileID(combine_context, file_id_list, (size_t)search_topk_,
+                                                        extra_params_, vectors_data_, result_ids, result_distances);
             }
         }
 
+        for (auto& request : request_list_) {
+            ShareStages(combine_context, request);
+        }
+
         rc.RecordSection("search vectors from engine");
 
         if (!status.ok()) {
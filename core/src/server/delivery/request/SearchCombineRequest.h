@@ -37,6 +37,12 @@ class SearchCombineRequest : public BaseRequest {
     static bool
     CanCombine(const SearchRequestPtr& left, const SearchRequestPtr& right, int64_t max_nq = COMBINE_MAX_NQ);
 
+    int64_t
+    EstimateCost() const override;
+
+    int64_t
+    EstimateMemory() const override;
+
  protected:
     Status
     OnExecute() override;
@@ -0,0 +1,162 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/delivery/request/SearchMultiRequest.h"
+
+#include <memory>
+#include <string>
+
+#include "server/DBWrapper.h"
+#include "utils/Log.h"
+#include "utils/TimeRecorder.h"
+#include "utils/ValidationUtil.h"
+
+namespace milvus {
+namespace server {
+
+SearchMultiRequest::SearchMultiRequest(const std::shared_ptr<milvus::server::Context>& context,
+                                       std::vector<engine::CollectionQuery>& queries)
+    : BaseRequest(context, BaseRequest::kSearchMulti), queries_(queries) {
+}
+
+BaseRequestPtr
+SearchMultiRequest::Create(const std::shared_ptr<milvus::server::Context>& context,
+                           std::vector<engine::CollectionQuery>& queries) {
+    return std::shared_ptr<BaseRequest>(new SearchMultiRequest(context, queries));
+}
+
+int64_t
+SearchMultiRequest::EstimateCost() const {
+    int64_t cost = 0;
+    for (auto& query : queries_) {
+        cost += static_cast<int64_t>(query.vectors_.vector_count_ * query.k_);
+    }
+    return cost;
+}
+
+int64_t
+SearchMultiRequest::EstimateMemory() const {
+    int64_t memory = 0;
+    for (auto& query : queries_) {
+        memory += EstimateSearchMemory(query.vectors_.vector_count_, query.k_);
+    }
+    return memory;
+}
+
+void
+SearchMultiRequest::DescribeParams(milvus::json& params) const {
+    params["searches"] = milvus::json::array();
+    for (auto& query : queries_) {
+        milvus::json search;
+        search["collection_name"] = query.collection_id_;
+        search["partition_tags"] = query.partition_tags_;
+        search["nq"] = query.vectors_.vector_count_;
+        search["topk"] = query.k_;
+        search["params"] = query.extra_params_;
+        params["searches"].push_back(search);
+    }
+}
+
+std::vector<std::string>
+SearchMultiRequest::Collections() const {
+    std::vector<std::string> collections;
+    for (auto& query : queries_) {
+        collections.push_back(query.collection_id_);
+    }
+    return collections;
+}
+
+Status
+SearchMultiRequest::OnPreExecute() {
+    if (queries_.empty()) {
+        return Status(SERVER_INVALID_ARGUMENT, "No collection to search");
+    }
+
+    // an invalid collection query only fails itself, the others are still searched
+    for (auto& query : queries_) {
+        if (!query.status_.ok()) {
+            continue;
+        }
+        query.status_ = ValidationUtil::ValidateCollectionName(query.collection_id_);
+        if (query.status_.ok()) {
+            query.status_ = ValidationUtil::ValidateSearchTopk(query.k_);
+        }
+        if (query.status_.ok()) {
+            query.status_ = ValidationUtil::ValidateResultSize(query.vectors_.vector_count_, query.k_);
+        }
+        if (query.status_.ok()) {
+            query.status_ = ValidationUtil::ValidatePartitionTags(query.partition_tags_);
+        }
+        if (!query.status_.ok()) {
+            LOG_SERVER_ERROR_ << LogOut("[%s][%ld] %s", "search", 0, query.status_.message().c_str());
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+SearchMultiRequest::OnExecute() {
+    LOG_SERVER_INFO_ << LogOut("[%s][%ld] ", "search", 0) << "Search multi execute.";
+    try {
+        std::string hdr = "SearchMultiRequest execute(collection count=" + std::to_string(queries_.size()) + ")";
+        TimeRecorderAuto rc(LogOut("[%s][%ld] %s", "search", 0, hdr.c_str()));
+
+        for (auto& query : queries_) {
+            if (query.status_.ok()) {
+                query.status_ = CheckCollection(query);
+            }
+        }
+        rc.RecordSection("check validation");
+
+        auto status = DBWrapper::DB()->QueryMulti(context_, queries_);
+        if (!status.ok()) {
+            LOG_SERVER_ERROR_ << LogOut("[%s][%ld] Query fail: %s", "search", 0, status.message().c_str());
+            return status;
+        }
+        rc.RecordSection("query vectors from engine");
+    } catch (std::exception& ex) {
+        LOG_SERVER_ERROR_ << LogOut("[%s][%ld] Encounter exception: %s", "search", 0, ex.what());
+        return Status(SERVER_UNEXPECTED_ERROR, ex.what());
+    }
+
+    return Status::OK();
+}
+
+Status
+SearchMultiRequest::CheckCollection(engine::CollectionQuery& query) {
+    // only process root collection, ignore partition collection
+    engine::meta::CollectionSchema collection_schema;
+    collection_schema.collection_id_ = query.collection_id_;
+    auto status = DBWrapper::DB()->DescribeCollection(collection_schema);
+    if (!status.ok()) {
+        if (status.code() == DB_NOT_FOUND) {
+            return Status(SERVER_COLLECTION_NOT_EXIST, CollectionNotExistMsg(query.collection_id_));
+        }
+        return status;
+    }
+    if (!collection_schema.owner_collection_.empty()) {
+        return Status(SERVER_INVALID_COLLECTION_NAME, CollectionNotExistMsg(query.collection_id_));
+    }
+
+    // the omitted search parameters are filled with the auto-tuned values
+    DBWrapper::DB()->FillSearchParams(query.collection_id_, collection_schema.engine_type_, query.k_,
+                                      query.extra_params_);
+    status = ValidationUtil::ValidateSearchParams(query.extra_params_, collection_schema, query.k_);
+    if (!status.ok()) {
+        return status;
+    }
+
+    return ValidationUtil::ValidateVectorData(query.vectors_, collection_schema);
+}
+
+}  // namespace server
+}  // namespace milvus
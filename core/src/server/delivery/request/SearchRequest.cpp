@@ -15,8 +15,10 @@
 
 #include <fiu-local.h>
 
+#include "config/Config.h"
 #include "db/Utils.h"
 #include "server/DBWrapper.h"
+#include "server/context/Context.h"
 #include "utils/CommonUtil.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
@@ -41,6 +43,11 @@ SearchRequest::SearchRequest(const std::shared_ptr<milvus::server::Context>& con
       partition_list_(partition_list),
       file_id_list_(file_id_list),
       result_(result) {
+    if (context_ != nullptr && context_->GetStageTimer() == nullptr) {
+        float sample_rate = 0.0;
+        Config::GetInstance().GetEngineConfigSearchProfileSampleRate(sample_rate);
+        context_->SetStageTimer(std::make_shared<StageTimer>(StageTimer::Sample(sample_rate)));
+    }
 }
 
 BaseRequestPtr
@@ -52,6 +59,33 @@ SearchRequest::Create(const std::shared_ptr<milvus::server::Context>& context, c
         new SearchRequest(context, collection_name, vectors, topk, extra_params, partition_list, file_id_list, result));
 }
 
+int64_t
+SearchRequest::EstimateCost() const {
+    // the files to search are unknown before meta is queried, unless the client specify them
+    int64_t file_count = file_id_list_.empty() ? 1 : static_cast<int64_t>(file_id_list_.size());
+    return static_cast<int64_t>(vectors_data_.vector_count_) * topk_ * file_count;
+}
+
+int64_t
+SearchRequest::EstimateMemory() const {
+    return EstimateSearchMemory(vectors_data_.vector_count_, topk_);
+}
+
+void
+SearchRequest::DescribeParams(milvus::json& params) const {
+    params["collection_name"] = collection_name_;
+    params["partition_tags"] = partition_list_;
+    params["file_ids"] = file_id_list_;
+    params["nq"] = vectors_data_.vector_count_;
+    params["topk"] = topk_;
+    params["params"] = extra_params_;
+}
+
+std::vector<std::string>
+SearchRequest::Collections() const {
+    return {collection_name_};
+}
+
 Status
 SearchRequest::OnPreExecute() {
     LOG_SERVER_INFO_ << LogOut("[%s][%ld] ", "search", 0) << "Search pre-execute. Check search parameters";
@@ -103,7 +137,9 @@ SearchRequest::OnExecute() {
         // step 4: check collection existence
         // only process root collection, ignore partition collection
         collection_schema_.collection_id_ = collection_name_;
+        ContextStage meta_stage(context_, SearchStage::META);
         auto status = DBWrapper::DB()->DescribeCollection(collection_schema_);
+        meta_stage.Finish();
 
         fiu_do_on("SearchRequest.OnExecute.describe_collection_fail",
                   status = Status(milvus::SERVER_UNEXPECTED_ERROR, ""));
@@ -125,7 +161,13 @@ SearchRequest::OnExecute() {
             }
         }
 
-        // step 5: check search parameters
+        if (context_ != nullptr && context_->GetStageTimer() != nullptr) {
+            context_->GetStageTimer()->SetLabels(collection_name_,
+                                                 engine::utils::GetIndexName(collection_schema_.engine_type_));
+        }
+
+        // step 5: check search parameters, the omitted ones are filled with the auto-tuned values
+        DBWrapper::DB()->FillSearchParams(collection_name_, collection_schema_.engine_type_, topk_, extra_params_);
         status = ValidationUtil::ValidateSearchParams(extra_params_, collection_schema_, topk_);
         if (!status.ok()) {
             LOG_SERVER_ERROR_ << LogOut("[%s][%ld] Invalid search params: %s", "search", 0, status.message().c_str());
@@ -68,6 +68,18 @@ class SearchRequest : public BaseRequest {
         return collection_schema_;
     }
 
+    int64_t
+    EstimateCost() const override;
+
+    int64_t
+    EstimateMemory() const override;
+
+    void
+    DescribeParams(milvus::json& params) const override;
+
+    std::vector<std::string>
+    Collections() const override;
+
  protected:
     SearchRequest(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
                   const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
@@ -11,6 +11,7 @@
 
 #include "server/delivery/strategy/SearchReqStrategy.h"
 #include "config/Config.h"
+#include "metrics/Metrics.h"
 #include "server/delivery/request/SearchCombineRequest.h"
 #include "server/delivery/request/SearchRequest.h"
 #include "utils/CommonUtil.h"
@@ -18,68 +19,75 @@
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
-#include <queue>
+#include <deque>
 #include <string>
 
 namespace milvus {
 namespace server {
 
+namespace {
+// count of latest queued requests to look for combination, the scan is done with the queue locked
+constexpr int64_t COMBINE_SCAN_WINDOW = 8;
+}  // namespace
+
 SearchReqStrategy::SearchReqStrategy() {
     SetIdentity("SearchReqStrategy");
     AddSearchCombineMaxNqListener();
 }
 
 Status
-SearchReqStrategy::ReScheduleQueue(const BaseRequestPtr& request, std::queue<BaseRequestPtr>& queue) {
+SearchReqStrategy::ReScheduleQueue(const BaseRequestPtr& request, std::deque<BaseRequestPtr>& queue) {
     if (request->GetRequestType() != BaseRequest::kSearch) {
         std::string msg = "search strategy can only handle search request";
         LOG_SERVER_ERROR_ << msg;
 
         // directly put request to queue if the request is not a search request
-        queue.push(request);
+        queue.push_back(request);
         return Status::OK();
     }
 
     // if config set to 0, never combine, directly put request to queue
     if (search_combine_nq_ <= 0) {
-        queue.push(request);
+        queue.push_back(request);
         return Status::OK();
     }
 
     //    TimeRecorderAuto rc("SearchReqStrategy::ReScheduleQueue");
     SearchRequestPtr new_search_req = std::static_pointer_cast<SearchRequest>(request);
 
-    BaseRequestPtr last_req = queue.back();
-    if (last_req->GetRequestType() == BaseRequest::kSearch) {
-        SearchRequestPtr last_search_req = std::static_pointer_cast<SearchRequest>(last_req);
-        if (SearchCombineRequest::CanCombine(last_search_req, new_search_req, search_combine_nq_)) {
-            // combine requests, create a SearchCombineRequest to hold them
-            SearchCombineRequestPtr combine_request = std::make_shared<SearchCombineRequest>(search_combine_nq_);
-            combine_request->Combine(last_search_req);
-            combine_request->Combine(new_search_req);
-            queue.back() = combine_request;  // replace the last request to combine request
-            LOG_SERVER_DEBUG_ << "Combine 2 search request";
-        } else {
-            // directly put request to queue since the two search requests have different parameters
-            queue.push(request);
-        }
-    } else if (last_req->GetRequestType() == BaseRequest::kSearchCombine) {
-        SearchCombineRequestPtr combine_req = std::static_pointer_cast<SearchCombineRequest>(last_req);
-        if (combine_req->CanCombine(new_search_req)) {
-            // combine requests, the last request is a SearchCombineRequest
-            combine_req->Combine(new_search_req);
-            LOG_SERVER_DEBUG_ << "Combine more search request";
-        } else {
-            // directly put request to queue since the two search requests have different parameters
-            queue.push(request);
+    // scan the latest requests in queue, so that the new request could be combined with a compatible request
+    // even if they are not adjacent, the queue could contains PreloadRequest/GetEntityByID/ReloadSegment request
+    int64_t distance = 0;
+    for (auto iter = queue.rbegin(); iter != queue.rend() && distance < COMBINE_SCAN_WINDOW; ++iter, ++distance) {
+        BaseRequestPtr& queued_req = *iter;
+        if (queued_req->GetRequestType() == BaseRequest::kSearch) {
+            SearchRequestPtr queued_search_req = std::static_pointer_cast<SearchRequest>(queued_req);
+            if (SearchCombineRequest::CanCombine(queued_search_req, new_search_req, search_combine_nq_)) {
+                // combine requests, create a SearchCombineRequest to hold them
+                SearchCombineRequestPtr combine_request = std::make_shared<SearchCombineRequest>(search_combine_nq_);
+                combine_request->Combine(queued_search_req);
+                combine_request->Combine(new_search_req);
+                queued_req = combine_request;  // replace the queued request to combine request
+                LOG_SERVER_DEBUG_ << "Combine 2 search request, distance to queue tail: " << distance;
+                Metrics::GetInstance().SearchCombinedTotalIncrement();
+                return Status::OK();
+            }
+        } else if (queued_req->GetRequestType() == BaseRequest::kSearchCombine) {
+            SearchCombineRequestPtr combine_req = std::static_pointer_cast<SearchCombineRequest>(queued_req);
+            if (combine_req->CanCombine(new_search_req)) {
+                // combine requests, the queued request is a SearchCombineRequest
+                combine_req->Combine(new_search_req);
+                LOG_SERVER_DEBUG_ << "Combine more search request, distance to queue tail: " << distance;
+                Metrics::GetInstance().SearchCombinedTotalIncrement();
+                return Status::OK();
+            }
         }
-    } else {
-        // the search queue could contains PreloadRequest/GetEntityByID/ReloadSegment request
-        // if the last request is not SearchRequest/SearchCombineRequest, we can't do combination
-        // directly put request to queue
-        queue.push(request);
     }
 
+    // directly put request to queue since no compatible search request in the scan window
+    queue.push_back(request);
+    Metrics::GetInstance().SearchNotCombinedTotalIncrement();
+
     return Status::OK();
 }
 
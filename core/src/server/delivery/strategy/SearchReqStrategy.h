@@ -15,8 +15,8 @@
 #include "server/delivery/strategy/RequestStrategy.h"
 #include "utils/Status.h"
 
+#include <deque>
 #include <memory>
-#include <queue>
 
 namespace milvus {
 namespace server {
@@ -26,7 +26,7 @@ class SearchReqStrategy : public RequestStrategy, public EngineConfigHandler {
     SearchReqStrategy();
 
     Status
-    ReScheduleQueue(const BaseRequestPtr& request, std::queue<BaseRequestPtr>& queue) override;
+    ReScheduleQueue(const BaseRequestPtr& request, std::deque<BaseRequestPtr>& queue) override;
 };
 
 using RequestStrategyPtr = std::shared_ptr<RequestStrategy>;
@@ -0,0 +1,90 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/grpc_impl/GrpcAsyncCall.h"
+
+#include "utils/Log.h"
+
+namespace milvus {
+namespace server {
+namespace grpc {
+
+std::mutex GrpcAsyncCall::executing_mutex_;
+std::condition_variable GrpcAsyncCall::executing_cv_;
+int64_t GrpcAsyncCall::executing_count_ = 0;
+
+void
+GrpcAsyncCall::WaitExecutingCalls() {
+    std::unique_lock<std::mutex> lock(executing_mutex_);
+    executing_cv_.wait(lock, [] { return executing_count_ == 0; });
+}
+
+void
+GrpcAsyncCall::BeginExecute() {
+    std::lock_guard<std::mutex> lock(executing_mutex_);
+    ++executing_count_;
+}
+
+void
+GrpcAsyncCall::EndExecute() {
+    {
+        std::lock_guard<std::mutex> lock(executing_mutex_);
+        --executing_count_;
+    }
+    executing_cv_.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+GrpcSearchCall::GrpcSearchCall(GrpcAsyncService* service, ::grpc::ServerCompletionQueue* cq)
+    : service_(service), cq_(cq), responder_(&context_) {
+    service_->RequestSearch(&context_, &request_, &responder_, cq_, cq_, this);
+}
+
+void
+GrpcSearchCall::Proceed(bool ok) {
+    switch (state_) {
+        case CallState::WAIT_REQUEST: {
+            if (!ok) {
+                // the server is shutting down, no more rpc
+                delete this;
+                return;
+            }
+
+            // wait for the next search rpc while this one is executed
+            new GrpcSearchCall(service_, cq_);
+
+            state_ = CallState::EXECUTE;
+            BeginExecute();
+            service_->SearchAsync(&context_, &request_, &response_, [this]() {
+                // invoked by request executor, the finish event is handled by completion queue thread
+                state_ = CallState::FINISH;
+                responder_.Finish(response_, ::grpc::Status::OK, this);
+                EndExecute();
+            });
+            break;
+        }
+        case CallState::FINISH: {
+            if (!ok) {
+                LOG_SERVER_WARNING_ << "Failed to send search response, the client may have gone";
+            }
+            delete this;
+            break;
+        }
+        default: {
+            LOG_SERVER_ERROR_ << "Unexpected search call event";
+            break;
+        }
+    }
+}
+
+}  // namespace grpc
+}  // namespace server
+}  // namespace milvus
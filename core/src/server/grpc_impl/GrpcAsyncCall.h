@@ -0,0 +1,83 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <grpcpp/grpcpp.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include "grpc/gen-milvus/milvus.grpc.pb.h"
+#include "server/grpc_impl/GrpcRequestHandler.h"
+
+namespace milvus {
+namespace server {
+namespace grpc {
+
+// search rpc is served by completion queue, other rpcs are still served synchronously by GrpcRequestHandler
+using GrpcAsyncService = ::milvus::grpc::MilvusService::WithAsyncMethod_Search<GrpcRequestHandler>;
+
+// an rpc served by completion queue, the object address is used as completion queue tag
+// and the object deletes itself when the rpc is finished
+class GrpcAsyncCall {
+ public:
+    virtual ~GrpcAsyncCall() = default;
+
+    // invoked by completion queue thread when an event of this call is dequeued
+    virtual void
+    Proceed(bool ok) = 0;
+
+    // block until no call is being executed by request executor,
+    // the completion queues must not be shutdown before that since the executor need them to send response
+    static void
+    WaitExecutingCalls();
+
+ protected:
+    static void
+    BeginExecute();
+
+    static void
+    EndExecute();
+
+ private:
+    static std::mutex executing_mutex_;
+    static std::condition_variable executing_cv_;
+    static int64_t executing_count_;
+};
+
+class GrpcSearchCall : public GrpcAsyncCall {
+ public:
+    GrpcSearchCall(GrpcAsyncService* service, ::grpc::ServerCompletionQueue* cq);
+
+    void
+    Proceed(bool ok) override;
+
+ private:
+    enum class CallState {
+        WAIT_REQUEST,
+        EXECUTE,
+        FINISH,
+    };
+
+    GrpcAsyncService* service_;
+    ::grpc::ServerCompletionQueue* cq_;
+    ::grpc::ServerContext context_;
+    ::milvus::grpc::SearchParam request_;
+    ::milvus::grpc::TopKQueryResult response_;
+    ::grpc::ServerAsyncResponseWriter<::milvus::grpc::TopKQueryResult> responder_;
+    CallState state_ = CallState::WAIT_REQUEST;
+};
+
+}  // namespace grpc
+}  // namespace server
+}  // namespace milvus
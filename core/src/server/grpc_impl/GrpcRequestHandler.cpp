@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "query/BinaryQuery.h"
+#include "server/Profiler.h"
 #include "server/context/ConnectionContext.h"
 #include "tracing/TextMapCarrier.h"
 #include "tracing/TracerUtil.h"
@@ -90,6 +91,9 @@ RequestMap(BaseRequest::RequestType request_type) {
 }
 
 namespace {
+// serialized ids and distances carried by one message of a streamed search result
+constexpr int64_t SEARCH_STREAM_CHUNK_BYTES = 1024 * 1024;
+
 void
 CopyRowRecords(const google::protobuf::RepeatedPtrField<::milvus::grpc::RowRecord>& grpc_records,
                const google::protobuf::RepeatedField<google::protobuf::int64>& grpc_id_array,
@@ -138,12 +142,90 @@ ConstructResults(const TopKQueryResult& result, ::milvus::grpc::TopKQueryResult*
 
     response->set_row_num(result.row_num_);
 
-    response->mutable_ids()->Resize(static_cast<int>(result.id_list_.size()), 0);
-    memcpy(response->mutable_ids()->mutable_data(), result.id_list_.data(), result.id_list_.size() * sizeof(int64_t));
+    // reserve and copy once, Resize() would fill the large buffers with zero before the copy
+    int id_count = static_cast<int>(result.id_list_.size());
+    if (id_count > 0) {
+        response->mutable_ids()->Reserve(id_count);
+        memcpy(response->mutable_ids()->AddNAlreadyReserved(id_count), result.id_list_.data(),
+               id_count * sizeof(int64_t));
+    }
+
+    int distance_count = static_cast<int>(result.distance_list_.size());
+    if (distance_count > 0) {
+        response->mutable_distances()->Reserve(distance_count);
+        memcpy(response->mutable_distances()->AddNAlreadyReserved(distance_count), result.distance_list_.data(),
+               distance_count * sizeof(float));
+    }
+}
+
+// copy rows [row_offset, row_offset + row_count) of the result, used to split a large result into messages
+void
+ConstructResultRows(const TopKQueryResult& result, int64_t row_offset, int64_t row_count,
+                    ::milvus::grpc::TopKQueryResult* response) {
+    response->set_row_num(row_count);
+    if (row_count <= 0) {
+        return;
+    }
+
+    int64_t topk = static_cast<int64_t>(result.id_list_.size()) / result.row_num_;
+    int count = static_cast<int>(row_count * topk);
+    response->mutable_ids()->Reserve(count);
+    memcpy(response->mutable_ids()->AddNAlreadyReserved(count), result.id_list_.data() + row_offset * topk,
+           count * sizeof(int64_t));
+    response->mutable_distances()->Reserve(count);
+    memcpy(response->mutable_distances()->AddNAlreadyReserved(count),
+           result.distance_list_.data() + row_offset * topk, count * sizeof(float));
+}
+
+struct SearchArgs {
+    engine::VectorsData vectors_;
+    std::vector<std::string> partitions_;
+    milvus::json json_params_;
+    std::vector<std::string> file_ids_;
+    TopKQueryResult result_;
+};
+
+Status
+ParseSearchParam(const ::milvus::grpc::SearchParam* request, SearchArgs& args) {
+    // step 1: copy vector data
+    CopyRowRecords(request->query_record_array(), google::protobuf::RepeatedField<google::protobuf::int64>(),
+                   args.vectors_);
+
+    // step 2: partition tags
+    std::copy(request->partition_tag_array().begin(), request->partition_tag_array().end(),
+              std::back_inserter(args.partitions_));
+
+    // step 3: parse extra parameters
+    for (int i = 0; i < request->extra_params_size(); i++) {
+        const ::milvus::grpc::KeyValuePair& extra = request->extra_params(i);
+        if (extra.key() == EXTRA_PARAM_KEY) {
+            // async searches are parsed on the completion queue thread, nothing may be thrown out of it
+            try {
+                args.json_params_ = json::parse(extra.value());
+            } catch (std::exception& e) {
+                return Status(SERVER_INVALID_ARGUMENT, "Invalid extra_params: " + std::string(e.what()));
+            }
+        }
+    }
+    fiu_do_on("GrpcRequestHandler.Search.not_empty_file_ids", args.file_ids_.emplace_back("test_file_id"));
+    return Status::OK();
+}
+
+// export the search stage breakdown, sampled requests also carry it in the reason of a successful status
+void
+ConstructSearchResults(const std::shared_ptr<Context>& context, const TopKQueryResult& result, Status& status,
+                       ::milvus::grpc::TopKQueryResult* response) {
+    ContextStage serialize_stage(context, SearchStage::SERIALIZE);
+    ConstructResults(result, response);
+    serialize_stage.Finish();
 
-    response->mutable_distances()->Resize(static_cast<int>(result.distance_list_.size()), 0.0);
-    memcpy(response->mutable_distances()->mutable_data(), result.distance_list_.data(),
-           result.distance_list_.size() * sizeof(float));
+    if (context != nullptr && context->GetStageTimer() != nullptr) {
+        auto& stage_timer = context->GetStageTimer();
+        stage_timer->Observe();
+        if (stage_timer->Sampled() && status.ok()) {
+            status = Status(SERVER_SUCCESS, stage_timer->ToString());
+        }
+    }
 }
 
 class GrpcConnectionContext : public milvus::server::ConnectionContext {
@@ -210,6 +292,9 @@ get_request_id(::grpc::ServerContext* context) {
 
 }  // namespace
 
+GrpcRequestHandler::GrpcRequestHandler() : GrpcRequestHandler(opentracing::Tracer::Global()) {
+}
+
 GrpcRequestHandler::GrpcRequestHandler(const std::shared_ptr<opentracing::Tracer>& tracer)
     : tracer_(tracer), random_num_generator_() {
     std::random_device random_device;
@@ -238,7 +323,11 @@ GrpcRequestHandler::OnPostRecvInitialMetaData(
         std::cerr << span_context_maybe.error().message() << std::endl;
         return;
     }
-    auto span = tracer_->StartSpan(server_rpc_info->method(), {opentracing::ChildOf(span_context_maybe->get())});
+    // a request carrying a trace context is always traced, the others are sampled
+    auto& tracer = (span_context_maybe->get() != nullptr || tracing::TracerUtil::Sample())
+                       ? tracer_
+                       : tracing::TracerUtil::NoopTracer();
+    auto span = tracer->StartSpan(server_rpc_info->method(), {opentracing::ChildOf(span_context_maybe->get())});
 
     auto server_context = server_rpc_info->server_context();
     auto client_metadata = server_context->client_metadata();
@@ -310,6 +399,12 @@ GrpcRequestHandler::GetContext(::grpc::ServerContext* server_context) {
     if (iter->second != nullptr) {
         ConnectionContextPtr connection_context = std::make_shared<GrpcConnectionContext>(server_context);
         iter->second->SetConnectionContext(connection_context);
+
+        // grpc reports time_point::max() if the client does not set a deadline
+        auto deadline = server_context->deadline();
+        if (deadline != std::chrono::system_clock::time_point::max()) {
+            iter->second->SetDeadline(deadline);
+        }
     }
     return iter->second;
 }
@@ -488,37 +583,24 @@ GrpcRequestHandler::Search(::grpc::ServerContext* context, const ::milvus::grpc:
     CHECK_NULLPTR_RETURN(request);
     LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
 
-    // step 1: copy vector data
-    engine::VectorsData vectors;
-    CopyRowRecords(request->query_record_array(), google::protobuf::RepeatedField<google::protobuf::int64>(), vectors);
-
-    // step 2: partition tags
-    std::vector<std::string> partitions;
-    std::copy(request->partition_tag_array().begin(), request->partition_tag_array().end(),
-              std::back_inserter(partitions));
-
-    // step 3: parse extra parameters
-    milvus::json json_params;
-    for (int i = 0; i < request->extra_params_size(); i++) {
-        const ::milvus::grpc::KeyValuePair& extra = request->extra_params(i);
-        if (extra.key() == EXTRA_PARAM_KEY) {
-            json_params = json::parse(extra.value());
-        }
+    // step 1: parse search parameters
+    SearchArgs args;
+    Status status = ParseSearchParam(request, args);
+    if (!status.ok()) {
+        SET_RESPONSE(response->mutable_status(), status, context);
+        return ::grpc::Status::OK;
     }
+    TopKQueryResult& result = args.result_;
 
-    // step 4: search vectors
-    std::vector<std::string> file_ids;
-    TopKQueryResult result;
-    fiu_do_on("GrpcRequestHandler.Search.not_empty_file_ids", file_ids.emplace_back("test_file_id"));
-
-    Status status = request_handler_.Search(GetContext(context), request->collection_name(), vectors, request->topk(),
-                                            json_params, partitions, file_ids, result);
+    // step 2: search vectors
+    status = request_handler_.Search(GetContext(context), request->collection_name(), args.vectors_, request->topk(),
+                                     args.json_params_, args.partitions_, args.file_ids_, result);
 
     LOG_SERVER_DEBUG_C << "row num = " << result.row_num_ << ", id list length = " << result.id_list_.size()
                        << ", distance list length = " << result.distance_list_.size();
 
-    // step 5: construct and return result
-    ConstructResults(result, response);
+    // step 3: construct and return result
+    ConstructSearchResults(GetContext(context), result, status, response);
 
     LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
     SET_RESPONSE(response->mutable_status(), status, context);
@@ -526,6 +608,149 @@ GrpcRequestHandler::Search(::grpc::ServerContext* context, const ::milvus::grpc:
     return ::grpc::Status::OK;
 }
 
+void
+GrpcRequestHandler::SearchAsync(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
+                                ::milvus::grpc::TopKQueryResult* response, const std::function<void()>& done) {
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
+
+    // step 1: parse search parameters, the arguments must be alive until the request is done
+    auto args = std::make_shared<SearchArgs>();
+    Status parse_status = ParseSearchParam(request, *args);
+    if (!parse_status.ok()) {
+        // finish the call with the error instead of queuing the request
+        SET_RESPONSE(response->mutable_status(), parse_status, context);
+        done();
+        return;
+    }
+
+    // step 2: put request to queue, the response is constructed by the request executor
+    auto on_search_done = [this, context, response, done, args](const Status& status) {
+        LOG_SERVER_DEBUG_C << "row num = " << args->result_.row_num_
+                           << ", id list length = " << args->result_.id_list_.size()
+                           << ", distance list length = " << args->result_.distance_list_.size();
+        Status search_status = status;
+        ConstructSearchResults(GetContext(context), args->result_, search_status, response);
+
+        LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), "SearchAsync");
+        SET_RESPONSE(response->mutable_status(), search_status, context);
+        done();
+    };
+    request_handler_.SearchAsync(GetContext(context), request->collection_name(), args->vectors_, request->topk(),
+                                 args->json_params_, args->partitions_, args->file_ids_, args->result_,
+                                 on_search_done);
+}
+
+::grpc::Status
+GrpcRequestHandler::SearchStream(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
+                                 ::grpc::ServerWriter<::milvus::grpc::TopKQueryResult>* writer) {
+    CHECK_NULLPTR_RETURN(request);
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
+
+    // step 1: parse search parameters
+    SearchArgs args;
+    Status status = ParseSearchParam(request, args);
+    TopKQueryResult& result = args.result_;
+
+    // step 2: search vectors
+    if (status.ok()) {
+        status = request_handler_.Search(GetContext(context), request->collection_name(), args.vectors_,
+                                         request->topk(), args.json_params_, args.partitions_, args.file_ids_,
+                                         result);
+    }
+
+    // step 3: write whole rows per message, so no message grows beyond the chunk size whatever nq * topk is,
+    // the full result is already merged at this point so neither peak memory nor the first row latency improves
+    int64_t row_num = status.ok() ? result.row_num_ : 0;
+    int64_t topk = (row_num > 0) ? static_cast<int64_t>(result.id_list_.size()) / row_num : 0;
+    int64_t row_bytes = std::max<int64_t>(1, topk * (sizeof(int64_t) + sizeof(float)));
+    int64_t chunk_rows = std::max<int64_t>(1, SEARCH_STREAM_CHUNK_BYTES / row_bytes);
+
+    ContextStage serialize_stage(GetContext(context), SearchStage::SERIALIZE);
+    int64_t row_offset = 0;
+    do {
+        ::milvus::grpc::TopKQueryResult chunk;
+        int64_t row_count = std::min(chunk_rows, row_num - row_offset);
+        ConstructResultRows(result, row_offset, row_count, &chunk);
+        SET_RESPONSE(chunk.mutable_status(), status, context);
+        if (!writer->Write(chunk)) {
+            LOG_SERVER_WARNING_ << LogOut("Request [%s] %s stream closed by client.",
+                                          GetContext(context)->RequestID().c_str(), __func__);
+            break;
+        }
+        row_offset += row_count;
+    } while (row_offset < row_num);
+    serialize_stage.Finish();
+
+    auto& stage_timer = GetContext(context)->GetStageTimer();
+    if (stage_timer != nullptr) {
+        stage_timer->Observe();
+    }
+
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRequestHandler::SearchMulti(
+    ::grpc::ServerContext* context,
+    ::grpc::ServerReaderWriter<::milvus::grpc::TopKQueryResult, ::milvus::grpc::SearchParam>* stream) {
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
+
+    // step 1: every search parameters in the stream is a query on one collection, a query with invalid
+    // parameters is not searched and only carries its own status
+    std::vector<engine::CollectionQuery> queries;
+    std::vector<Status> parse_status;
+    ::milvus::grpc::SearchParam request;
+    while (stream->Read(&request)) {
+        SearchArgs args;
+        parse_status.emplace_back(ParseSearchParam(&request, args));
+        if (!parse_status.back().ok()) {
+            continue;
+        }
+
+        engine::CollectionQuery query;
+        query.collection_id_ = request.collection_name();
+        query.partition_tags_.swap(args.partitions_);
+        query.k_ = request.topk();
+        query.extra_params_ = args.json_params_;
+        query.vectors_ = std::move(args.vectors_);
+        queries.emplace_back(std::move(query));
+    }
+
+    // step 2: search all collections together
+    Status status = queries.empty() ? Status::OK() : request_handler_.SearchMulti(GetContext(context), queries);
+
+    // step 3: results follow the order of searches, a failed search only carries its own status
+    auto query_iter = queries.begin();
+    for (auto& query_parse_status : parse_status) {
+        ::milvus::grpc::TopKQueryResult response;
+        if (!query_parse_status.ok()) {
+            SET_RESPONSE(response.mutable_status(), query_parse_status, context);
+            if (!stream->Write(response)) {
+                break;
+            }
+            continue;
+        }
+
+        auto& query = *query_iter++;
+        Status query_status = status.ok() ? query.status_ : status;
+        if (query_status.ok()) {
+            TopKQueryResult result;
+            result.row_num_ = query.result_ids_.empty() ? 0 : query.vectors_.vector_count_;
+            result.id_list_.swap(query.result_ids_);
+            result.distance_list_.swap(query.result_distances_);
+            ConstructResults(result, &response);
+        }
+        SET_RESPONSE(response.mutable_status(), query_status, context);
+        if (!stream->Write(response)) {
+            break;
+        }
+    }
+
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+    return ::grpc::Status::OK;
+}
+
 ::grpc::Status
 GrpcRequestHandler::SearchByID(::grpc::ServerContext* context, const ::milvus::grpc::SearchByIDParam* request,
                                ::milvus::grpc::TopKQueryResult* response) {
@@ -709,6 +934,10 @@ GrpcRequestHandler::Cmd(::grpc::ServerContext* context, const ::milvus::grpc::Co
         reply_json["requests"] = requests;
         reply = reply_json.dump();
         response->set_string_reply(reply);
+    } else if (cmd.substr(0, 7) == "profile") {
+        // sampled on this thread, queueing it would block the info request group for the whole profile
+        status = Profiler::GetInstance().ProcessProfileCli(reply, cmd);
+        response->set_string_reply(reply);
     } else {
         status = request_handler_.Cmd(GetContext(context), cmd, reply);
         response->set_string_reply(reply);
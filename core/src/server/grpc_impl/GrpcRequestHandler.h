@@ -14,6 +14,7 @@
 #include <grpcpp/server_context.h>
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <random>
@@ -59,8 +60,11 @@ ErrorMap(ErrorCode code);
 
 extern const char* EXTRA_PARAM_KEY;
 
-class GrpcRequestHandler final : public ::milvus::grpc::MilvusService::Service, public GrpcInterceptorHookHandler {
+class GrpcRequestHandler : public ::milvus::grpc::MilvusService::Service, public GrpcInterceptorHookHandler {
  public:
+    // use the global tracer, required by the generated asynchronous service templates
+    GrpcRequestHandler();
+
     explicit GrpcRequestHandler(const std::shared_ptr<opentracing::Tracer>& tracer);
 
     void
@@ -247,6 +251,39 @@ class GrpcRequestHandler final : public ::milvus::grpc::MilvusService::Service,
     Search(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
            ::milvus::grpc::TopKQueryResult* response) override;
 
+    // *
+    // @brief Asynchronous version of Search, return once the request is queued.
+    //        The done callback is invoked by the request executor after the response is filled.
+    //
+    // @param SearchParam, search parameters.
+    //
+    // @return TopKQueryResultList
+    void
+    SearchAsync(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
+                ::milvus::grpc::TopKQueryResult* response, const std::function<void()>& done);
+
+    // *
+    // @brief Streaming version of Search, the result rows are written in messages of bounded size.
+    //        The whole result is still searched and held in memory before the first message is written.
+    //
+    // @param SearchParam, search parameters.
+    //
+    // @return stream of TopKQueryResult
+    ::grpc::Status
+    SearchStream(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
+                 ::grpc::ServerWriter<::milvus::grpc::TopKQueryResult>* writer) override;
+
+    // *
+    // @brief This method is used to query vectors in several collections at once.
+    //
+    // @param SearchParam, one search parameters per collection, read from the stream.
+    //
+    // @return stream of TopKQueryResult, one result per search in the same order.
+    ::grpc::Status
+    SearchMulti(
+        ::grpc::ServerContext* context,
+        ::grpc::ServerReaderWriter<::milvus::grpc::TopKQueryResult, ::milvus::grpc::SearchParam>* stream) override;
+
     // *
     // @brief This method is used to query vector by id.
     //
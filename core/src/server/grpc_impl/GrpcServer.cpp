@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "GrpcRequestHandler.h"
+#include "server/grpc_impl/GrpcAsyncCall.h"
 #include "config/Config.h"
 #include "grpc/gen-milvus/milvus.grpc.pb.h"
 #include "server/DBWrapper.h"
@@ -44,6 +45,25 @@ namespace grpc {
 
 constexpr int64_t MESSAGE_SIZE = -1;
 
+// completion queue threads only parse requests and send responses, the search is done by request executors
+constexpr int64_t COMPLETION_QUEUE_NUM = 2;
+
+namespace {
+void
+HandleAsyncCalls(GrpcAsyncService* service, ::grpc::ServerCompletionQueue* cq) {
+    SetThreadName("grpccq_thread");
+
+    // the call object deletes itself when the rpc is finished
+    new GrpcSearchCall(service, cq);
+
+    void* tag = nullptr;
+    bool ok = false;
+    while (cq->Next(&tag, &ok)) {
+        static_cast<GrpcAsyncCall*>(tag)->Proceed(ok);
+    }
+}
+}  // namespace
+
 // this class is to check port occupation during server start
 class NoReusePortOption : public ::grpc::ServerBuilderOption {
  public:
@@ -95,7 +115,7 @@ GrpcServer::StartService() {
     builder.SetDefaultCompressionAlgorithm(GRPC_COMPRESS_STREAM_GZIP);
     builder.SetDefaultCompressionLevel(GRPC_COMPRESS_LEVEL_NONE);
 
-    GrpcRequestHandler service(opentracing::Tracer::Global());
+    GrpcAsyncService service;
     service.RegisterRequestHandler(RequestHandler());
 
     builder.AddListeningPort(server_address, ::grpc::InsecureServerCredentials());
@@ -111,9 +131,29 @@ GrpcServer::StartService() {
 
     builder.experimental().SetInterceptorCreators(std::move(creators));
 
+    // search rpc doesn't hold a grpc thread while it is waiting in request queue
+    std::vector<std::unique_ptr<::grpc::ServerCompletionQueue>> completion_queues;
+    for (int64_t i = 0; i < COMPLETION_QUEUE_NUM; ++i) {
+        completion_queues.emplace_back(builder.AddCompletionQueue());
+    }
+
     server_ptr_ = builder.BuildAndStart();
+
+    std::vector<std::thread> cq_threads;
+    for (auto& cq : completion_queues) {
+        cq_threads.emplace_back(&HandleAsyncCalls, &service, cq.get());
+    }
+
     server_ptr_->Wait();
 
+    GrpcAsyncCall::WaitExecutingCalls();
+    for (auto& cq : completion_queues) {
+        cq->Shutdown();
+    }
+    for (auto& thread : cq_threads) {
+        thread.join();
+    }
+
     return Status::OK();
 }
 
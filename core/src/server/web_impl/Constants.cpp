@@ -32,6 +32,9 @@ const char* NAME_METRIC_TYPE_TANIMOTO = "TANIMOTO";
 const char* NAME_METRIC_TYPE_SUBSTRUCTURE = "SUBSTRUCTURE";
 const char* NAME_METRIC_TYPE_SUPERSTRUCTURE = "SUPERSTRUCTURE";
 
+// client timeout of a request in milliseconds
+const char* NAME_HEADER_REQUEST_TIMEOUT = "Request-Timeout";
+
 ////////////////////////////////////////////////////
 const int64_t VALUE_COLLECTION_INDEX_FILE_SIZE_DEFAULT = 1024;
 const char* VALUE_COLLECTION_METRIC_TYPE_DEFAULT = "L2";
@@ -37,6 +37,8 @@ extern const char* NAME_METRIC_TYPE_TANIMOTO;
 extern const char* NAME_METRIC_TYPE_SUBSTRUCTURE;
 extern const char* NAME_METRIC_TYPE_SUPERSTRUCTURE;
 
+extern const char* NAME_HEADER_REQUEST_TIMEOUT;
+
 ////////////////////////////////////////////////////
 extern const int64_t VALUE_COLLECTION_INDEX_FILE_SIZE_DEFAULT;
 extern const char* VALUE_COLLECTION_METRIC_TYPE_DEFAULT;
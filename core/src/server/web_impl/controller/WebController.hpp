@@ -626,12 +626,13 @@ class WebController : public oatpp::web::server::api::ApiController {
     ADD_CORS(VectorsOp)
 
     ENDPOINT("PUT", "/collections/{collection_name}/vectors", VectorsOp, PATH(String, collection_name),
-             BODY_STRING(String, body)) {
+             BODY_STRING(String, body), REQUEST(std::shared_ptr<IncomingRequest>, request)) {
         TimeRecorder tr(std::string(WEB_LOG_PREFIX) + "PUT \'/collections/" + collection_name->std_str() +
                         "/vectors\'");
         tr.RecordSection("Received request.");
 
         WebRequestHandler handler = WebRequestHandler();
+        handler.SetRequestTimeout(request->getHeader(NAME_HEADER_REQUEST_TIMEOUT));
 
         OString result;
         std::shared_ptr<OutgoingResponse> response;
@@ -653,6 +654,39 @@ class WebController : public oatpp::web::server::api::ApiController {
         return response;
     }
 
+    ADD_CORS(SearchOptions)
+
+    ENDPOINT("OPTIONS", "/search", SearchOptions) {
+        return createResponse(Status::CODE_204, "No Content");
+    }
+
+    ADD_CORS(SearchMulti)
+
+    ENDPOINT("PUT", "/search", SearchMulti, BODY_STRING(String, body),
+             REQUEST(std::shared_ptr<IncomingRequest>, request)) {
+        TimeRecorder tr(std::string(WEB_LOG_PREFIX) + "PUT \'/search\'");
+        tr.RecordSection("Received request.");
+
+        WebRequestHandler handler = WebRequestHandler();
+        handler.SetRequestTimeout(request->getHeader(NAME_HEADER_REQUEST_TIMEOUT));
+
+        OString result;
+        std::shared_ptr<OutgoingResponse> response;
+        auto status_dto = handler.SearchMulti(body, result);
+        switch (status_dto->code->getValue()) {
+            case StatusCode::SUCCESS:
+                response = createResponse(Status::CODE_200, result);
+                break;
+            default:
+                response = createDtoResponse(Status::CODE_400, status_dto);
+        }
+
+        tr.ElapseFromBegin("Done. Status: code = " + std::to_string(status_dto->code->getValue()) +
+                           ", reason = " + status_dto->message->std_str() + ". Total cost");
+
+        return response;
+    }
+
     ADD_CORS(SystemOptions)
 
     ENDPOINT("OPTIONS", "/system/{info}", SystemOptions) {
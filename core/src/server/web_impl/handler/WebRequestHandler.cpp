@@ -12,6 +12,8 @@
 #include "server/web_impl/handler/WebRequestHandler.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <ctime>
 #include <string>
 #include <unordered_map>
@@ -21,6 +23,7 @@
 
 #include "config/Config.h"
 #include "metrics/SystemInfo.h"
+#include "server/Profiler.h"
 #include "server/delivery/request/BaseRequest.h"
 #include "server/web_impl/Constants.h"
 #include "server/web_impl/Types.h"
@@ -109,20 +112,36 @@ WebRequestHandler::CopyRecordsFromJson(const nlohmann::json& json, engine::Vecto
 
     vectors.vector_count_ = json.size();
 
-    if (!bin) {
-        for (auto& vec : json) {
-            if (!vec.is_array()) {
-                return Status(ILLEGAL_BODY, "A vector in field \"vectors\" must be a float array");
+    for (auto& vec : json) {
+        // a vector is either a number array or a base64 string of its little-endian bytes
+        if (vec.is_string()) {
+            std::string bytes;
+            auto status = StringHelpFunctions::DecodeBase64(vec.get<std::string>(), bytes);
+            if (!status.ok()) {
+                return Status(ILLEGAL_BODY, status.message());
             }
-            for (auto& data : vec) {
-                vectors.float_data_.emplace_back(data.get<float>());
+            if (!bin) {
+                if (bytes.size() % sizeof(float) != 0) {
+                    return Status(ILLEGAL_BODY, "A base64 vector in field \"vectors\" must hold float32 values");
+                }
+                auto& float_data = vectors.float_data_;
+                size_t offset = float_data.size();
+                float_data.resize(offset + bytes.size() / sizeof(float));
+                memcpy(float_data.data() + offset, bytes.data(), bytes.size());
+            } else {
+                vectors.binary_data_.insert(vectors.binary_data_.end(), bytes.begin(), bytes.end());
             }
+            continue;
         }
-    } else {
-        for (auto& vec : json) {
-            if (!vec.is_array()) {
-                return Status(ILLEGAL_BODY, "A vector in field \"vectors\" must be a float array");
+
+        if (!vec.is_array()) {
+            return Status(ILLEGAL_BODY, "A vector in field \"vectors\" must be an array or a base64 string");
+        }
+        if (!bin) {
+            for (auto& data : vec) {
+                vectors.float_data_.emplace_back(data.get<float>());
             }
+        } else {
             for (auto& data : vec) {
                 vectors.binary_data_.emplace_back(data.get<uint8_t>());
             }
@@ -132,6 +151,61 @@ WebRequestHandler::CopyRecordsFromJson(const nlohmann::json& json, engine::Vecto
     return Status::OK();
 }
 
+Status
+WebRequestHandler::ParseResultEncoding(const nlohmann::json& json, bool& base64) {
+    base64 = false;
+    if (json.contains("result_encoding")) {
+        auto& encoding = json["result_encoding"];
+        if (!encoding.is_string() || encoding.get<std::string>() != "base64") {
+            return Status(ILLEGAL_BODY, "Field \"result_encoding\" only supports \"base64\"");
+        }
+        base64 = true;
+    }
+
+    return Status::OK();
+}
+
+void
+WebRequestHandler::SearchResultToStr(const TopKQueryResult& result, bool base64, std::string& result_str) {
+    nlohmann::json result_json;
+    result_json["num"] = result.row_num_;
+    if (base64) {
+        // ids as int64 and distances as float32, both row-major of num * topk
+        result_json["topk"] = result.row_num_ > 0 ? result.id_list_.size() / result.row_num_ : 0;
+        result_json["ids"] =
+            StringHelpFunctions::EncodeBase64(result.id_list_.data(), result.id_list_.size() * sizeof(int64_t));
+        result_json["distances"] = StringHelpFunctions::EncodeBase64(result.distance_list_.data(),
+                                                                     result.distance_list_.size() * sizeof(float));
+        result_str = result_json.dump();
+        return;
+    }
+
+    if (result.row_num_ == 0) {
+        result_json["result"] = std::vector<int64_t>();
+        result_str = result_json.dump();
+        return;
+    }
+
+    // write rows straight into the response, a json object per hit costs far more memory than the result itself
+    // for a large topk. Keys keep the order nlohmann::json dumps them in.
+    auto step = result.id_list_.size() / result.row_num_;
+    result_str.clear();
+    result_str.reserve(result.id_list_.size() * 48 + 64);
+    result_str += "{\"num\":" + std::to_string(result.row_num_) + ",\"result\":[";
+    for (int64_t i = 0; i < result.row_num_; i++) {
+        result_str += (i == 0) ? "[" : ",[";
+        for (size_t j = 0; j < step; j++) {
+            if (j > 0) {
+                result_str += ",";
+            }
+            result_str += "{\"distance\":\"" + std::to_string(result.distance_list_[i * step + j]) + "\",\"id\":\"" +
+                          std::to_string(result.id_list_[i * step + j]) + "\"}";
+        }
+        result_str += "]";
+    }
+    result_str += "]}";
+}
+
 ///////////////////////// WebRequestHandler methods ///////////////////////////////////////
 Status
 WebRequestHandler::GetCollectionMetaInfo(const std::string& collection_name, nlohmann::json& json_out) {
@@ -459,6 +533,12 @@ WebRequestHandler::Search(const std::string& collection_name, const nlohmann::js
         return Status(BODY_FIELD_LOSS, "Field \'params\' is required");
     }
 
+    bool base64_result = false;
+    auto status = ParseResultEncoding(json, base64_result);
+    if (!status.ok()) {
+        return status;
+    }
+
     std::vector<std::string> partition_tags;
     if (json.contains("partition_tags")) {
         auto tags = json["partition_tags"];
@@ -472,7 +552,6 @@ WebRequestHandler::Search(const std::string& collection_name, const nlohmann::js
     }
 
     TopKQueryResult result;
-    Status status;
     if (json.contains("ids")) {
         auto vec_ids = json["ids"];
         if (!vec_ids.is_array()) {
@@ -521,28 +600,90 @@ WebRequestHandler::Search(const std::string& collection_name, const nlohmann::js
         return status;
     }
 
-    nlohmann::json result_json;
-    result_json["num"] = result.row_num_;
-    if (result.row_num_ == 0) {
-        result_json["result"] = std::vector<int64_t>();
-        result_str = result_json.dump();
-        return Status::OK();
+    ContextStage serialize_stage(context_ptr_, SearchStage::SERIALIZE);
+    SearchResultToStr(result, base64_result, result_str);
+    serialize_stage.Finish();
+    if (context_ptr_->GetStageTimer() != nullptr) {
+        context_ptr_->GetStageTimer()->Observe();
     }
 
-    auto step = result.id_list_.size() / result.row_num_;
-    nlohmann::json search_result_json;
-    for (int64_t i = 0; i < result.row_num_; i++) {
-        nlohmann::json raw_result_json;
-        for (size_t j = 0; j < step; j++) {
-            nlohmann::json one_result_json;
-            one_result_json["id"] = std::to_string(result.id_list_.at(i * step + j));
-            one_result_json["distance"] = std::to_string(result.distance_list_.at(i * step + j));
-            raw_result_json.emplace_back(one_result_json);
+    return Status::OK();
+}
+
+Status
+WebRequestHandler::SearchMulti(const nlohmann::json& json, std::string& result_str) {
+    if (!json.contains("searches") || !json["searches"].is_array()) {
+        return Status(BODY_FIELD_LOSS, "Field \"searches\" must be an array");
+    }
+
+    bool base64_result = false;
+    auto status = ParseResultEncoding(json, base64_result);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::vector<engine::CollectionQuery> queries;
+    for (auto& search : json["searches"]) {
+        engine::CollectionQuery query;
+        if (!search.contains("collection_name") || !search.contains("topk") || !search.contains("params") ||
+            !search.contains("vectors")) {
+            return Status(BODY_FIELD_LOSS, "Fields \"collection_name\", \"topk\", \"params\" and \"vectors\" are "
+                                           "required in each search");
+        }
+        query.collection_id_ = search["collection_name"].get<std::string>();
+        query.k_ = search["topk"].get<int64_t>();
+        query.extra_params_ = search["params"];
+
+        if (search.contains("partition_tags")) {
+            auto& tags = search["partition_tags"];
+            if (!tags.is_null() && !tags.is_array()) {
+                return Status(BODY_PARSE_FAIL, "Field \"partition_tags\" must be an array");
+            }
+            for (auto& tag : tags) {
+                query.partition_tags_.emplace_back(tag.get<std::string>());
+            }
+        }
+
+        bool bin_flag = false;
+        query.status_ = IsBinaryCollection(query.collection_id_, bin_flag);
+        if (query.status_.ok()) {
+            status = CopyRecordsFromJson(search["vectors"], query.vectors_, bin_flag);
+            if (!status.ok()) {
+                return status;
+            }
         }
-        search_result_json.emplace_back(raw_result_json);
+        queries.emplace_back(std::move(query));
     }
-    result_json["result"] = search_result_json;
-    result_str = result_json.dump();
+
+    status = request_handler_.SearchMulti(context_ptr_, queries);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // results follow the order of searches, a failed search only carries its own status
+    result_str = "{\"results\":[";
+    for (size_t i = 0; i < queries.size(); ++i) {
+        auto& query = queries[i];
+        if (i > 0) {
+            result_str += ",";
+        }
+        if (!query.status_.ok()) {
+            nlohmann::json error_json;
+            AddStatusToJson(error_json, static_cast<int64_t>(WebErrorMap(query.status_.code())),
+                            query.status_.message());
+            result_str += error_json.dump();
+            continue;
+        }
+
+        TopKQueryResult result;
+        result.row_num_ = query.result_ids_.empty() ? 0 : query.vectors_.vector_count_;
+        result.id_list_.swap(query.result_ids_);
+        result.distance_list_.swap(query.result_distances_);
+        std::string one_result_str;
+        SearchResultToStr(result, base64_result, one_result_str);
+        result_str += one_result_str;
+    }
+    result_str += "]}";
 
     return Status::OK();
 }
@@ -612,6 +753,22 @@ WebRequestHandler::GetVectorsByIDs(const std::string& collection_name, const std
 }
 
 ////////////////////////////////// Router methods ////////////////////////////////////////////
+void
+WebRequestHandler::SetRequestTimeout(const OString& timeout) {
+    if (timeout == nullptr || timeout->getSize() == 0) {
+        return;
+    }
+
+    auto timeout_str = timeout->std_str();
+    if (!ValidationUtil::ValidateStringIsNumber(timeout_str).ok()) {
+        LOG_SERVER_WARNING_ << "Ignore invalid " << NAME_HEADER_REQUEST_TIMEOUT << " header: " << timeout_str;
+        return;
+    }
+
+    auto deadline = std::chrono::system_clock::now() + std::chrono::milliseconds(std::stoll(timeout_str));
+    context_ptr_->SetDeadline(deadline);
+}
+
 StatusDto::ObjectWrapper
 WebRequestHandler::GetDevices(DevicesDto::ObjectWrapper& devices_dto) {
     auto system_info = SystemInfo::GetInstance();
@@ -1281,7 +1438,7 @@ WebRequestHandler::Insert(const OString& collection_name, const OString& body, V
         RETURN_STATUS_DTO(BODY_FIELD_LOSS, "Field \'vectors\' is required");
     }
     engine::VectorsData vectors;
-    CopyRecordsFromJson(body_json["vectors"], vectors, bin_flag);
+    status = CopyRecordsFromJson(body_json["vectors"], vectors, bin_flag);
     if (!status.ok()) {
         ASSIGN_RETURN_STATUS_DTO(status)
     }
@@ -1399,10 +1556,61 @@ WebRequestHandler::VectorsOp(const OString& collection_name, const OString& payl
     ASSIGN_RETURN_STATUS_DTO(status)
 }
 
+StatusDto::ObjectWrapper
+WebRequestHandler::SearchMulti(const OString& payload, OString& response) {
+    auto status = Status::OK();
+    std::string result_str;
+
+    try {
+        nlohmann::json payload_json = nlohmann::json::parse(payload->std_str());
+        status = SearchMulti(payload_json, result_str);
+    } catch (nlohmann::detail::parse_error& e) {
+        std::string emsg = "json error: code=" + std::to_string(e.id) + ", reason=" + e.what();
+        RETURN_STATUS_DTO(BODY_PARSE_FAIL, emsg.c_str());
+    } catch (nlohmann::detail::type_error& e) {
+        std::string emsg = "json error: code=" + std::to_string(e.id) + ", reason=" + e.what();
+        RETURN_STATUS_DTO(BODY_PARSE_FAIL, emsg.c_str());
+    } catch (std::exception& e) {
+        RETURN_STATUS_DTO(SERVER_UNEXPECTED_ERROR, e.what());
+    }
+
+    response = status.ok() ? result_str.c_str() : "NULL";
+
+    ASSIGN_RETURN_STATUS_DTO(status)
+}
+
 /**********
  *
  * System {
  */
+Status
+WebRequestHandler::Profile(const OQueryParams& query_params, std::string& result_str) {
+    std::string type = "cpu";
+    auto status = ParseQueryStr(query_params, "type", type);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::string cmd = "profile " + type;
+    if (type == "cpu") {
+        int64_t seconds = 10;
+        status = ParseQueryInteger(query_params, "seconds", seconds);
+        if (!status.ok()) {
+            return status;
+        }
+
+        std::string format = "folded";
+        status = ParseQueryStr(query_params, "format", format);
+        if (!status.ok()) {
+            return status;
+        }
+        cmd += " " + std::to_string(seconds) + " " + format;
+    }
+
+    // sampled on this thread rather than through the request queue, see GrpcRequestHandler::Cmd
+    return Profiler::GetInstance().ProcessProfileCli(result_str, cmd);
+}
+
 StatusDto::ObjectWrapper
 WebRequestHandler::SystemInfo(const OString& cmd, const OQueryParams& query_params, OString& response_str) {
     std::string info = cmd->std_str();
@@ -1413,6 +1621,8 @@ WebRequestHandler::SystemInfo(const OString& cmd, const OQueryParams& query_para
     try {
         if (info == "config") {
             status = GetConfig(result_str);
+        } else if (info == "profile") {
+            status = Profile(query_params, result_str);
         } else {
             if ("info" == info) {
                 info = "get_system_info";
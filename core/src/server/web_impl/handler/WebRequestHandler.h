@@ -87,6 +87,12 @@ class WebRequestHandler {
     Status
     CopyRecordsFromJson(const nlohmann::json& json, engine::VectorsData& vectors, bool bin);
 
+    Status
+    ParseResultEncoding(const nlohmann::json& json, bool& base64);
+
+    void
+    SearchResultToStr(const TopKQueryResult& result, bool base64, std::string& result_str);
+
  protected:
     Status
     GetCollectionMetaInfo(const std::string& collection_name, nlohmann::json& json_out);
@@ -123,12 +129,18 @@ class WebRequestHandler {
     Status
     GetConfig(std::string& result_str);
 
+    Status
+    Profile(const OQueryParams& query_params, std::string& result_str);
+
     Status
     SetConfig(const nlohmann::json& json, std::string& result_str);
 
     Status
     Search(const std::string& collection_name, const nlohmann::json& json, std::string& result_str);
 
+    Status
+    SearchMulti(const nlohmann::json& json, std::string& result_str);
+
     Status
     DeleteByIDs(const std::string& collection_name, const nlohmann::json& json, std::string& result_str);
 
@@ -143,6 +155,9 @@ class WebRequestHandler {
     }
 
  public:
+    void
+    SetRequestTimeout(const OString& timeout);
+
     StatusDto::ObjectWrapper
     GetDevices(DevicesDto::ObjectWrapper& devices);
 
@@ -214,6 +229,9 @@ class WebRequestHandler {
     StatusDto::ObjectWrapper
     VectorsOp(const OString& collection_name, const OString& payload, OString& response);
 
+    StatusDto::ObjectWrapper
+    SearchMulti(const OString& payload, OString& response);
+
     /**
      *
      * System
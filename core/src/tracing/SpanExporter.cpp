@@ -0,0 +1,76 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "tracing/SpanExporter.h"
+
+#include <opentracing/mocktracer/json.h>
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace milvus {
+namespace tracing {
+
+bool
+SpanExporter::Open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (path == "stdout") {
+        out_ = &std::cout;
+        return true;
+    }
+
+    file_.open(path, std::ios::out | std::ios::app);
+    if (!file_.good()) {
+        return false;
+    }
+    out_ = &file_;
+    return true;
+}
+
+void
+SpanExporter::RecordSpan(opentracing::mocktracer::SpanData&& span_data) noexcept {
+    try {
+        std::vector<opentracing::mocktracer::SpanData> spans;
+        spans.emplace_back(std::move(span_data));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (out_ != nullptr) {
+            opentracing::mocktracer::ToJson(*out_, spans);
+            *out_ << '\n';
+        }
+    } catch (std::exception& ex) {
+        std::cerr << "Failed to export span: " << ex.what() << std::endl;
+    }
+}
+
+void
+SpanExporter::Flush() noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (out_ != nullptr) {
+        out_->flush();
+    }
+}
+
+void
+SpanExporter::Close() noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (out_ != nullptr) {
+        out_->flush();
+        out_ = nullptr;
+    }
+    if (file_.is_open()) {
+        file_.close();
+    }
+}
+
+}  // namespace tracing
+}  // namespace milvus
@@ -0,0 +1,46 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <opentracing/mocktracer/recorder.h>
+
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace milvus {
+namespace tracing {
+
+// Writes every finished span as one json line, for the deployments without a trace collector.
+class SpanExporter : public opentracing::mocktracer::Recorder {
+ public:
+    // "stdout" writes to the standard output, any other path is opened for append
+    bool
+    Open(const std::string& path);
+
+    void
+    RecordSpan(opentracing::mocktracer::SpanData&& span_data) noexcept override;
+
+    void
+    Flush() noexcept override;
+
+    void
+    Close() noexcept override;
+
+ private:
+    std::mutex mutex_;
+    std::ofstream file_;
+    std::ostream* out_ = nullptr;
+};
+
+}  // namespace tracing
+}  // namespace milvus
@@ -31,6 +31,14 @@ TraceContext::Follower(const std::string& operation_name) const {
     return std::make_unique<TraceContext>(follower_span);
 }
 
+void
+TraceContext::Record(const std::string& operation_name,
+                     const std::chrono::system_clock::time_point& start_time) const {
+    auto span = span_->tracer().StartSpan(
+        operation_name, {opentracing::ChildOf(&(span_->context())), opentracing::StartTimestamp(start_time)});
+    span->Finish();
+}
+
 const std::unique_ptr<opentracing::Span>&
 TraceContext::GetSpan() const {
     return span_;
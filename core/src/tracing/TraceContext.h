@@ -13,6 +13,7 @@
 
 #include <opentracing/tracer.h>
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -29,6 +30,10 @@ class TraceContext {
     std::unique_ptr<TraceContext>
     Follower(const std::string& operation_name) const;
 
+    // a child span which started at start_time and finishes now, e.g. the time a request waited in queue
+    void
+    Record(const std::string& operation_name, const std::chrono::system_clock::time_point& start_time) const;
+
     const std::unique_ptr<opentracing::Span>&
     GetSpan() const;
 
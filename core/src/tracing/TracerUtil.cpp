@@ -12,12 +12,17 @@
 #include "tracing/TracerUtil.h"
 
 #include <opentracing/dynamic_load.h>
+#include <opentracing/mocktracer/tracer.h>
+#include <opentracing/noop.h>
 #include <opentracing/tracer.h>
 
 #include <fstream>
 #include <iostream>
+#include <random>
+#include <utility>
 
 #include "thirdparty/nlohmann/json.hpp"
+#include "tracing/SpanExporter.h"
 
 namespace milvus {
 namespace tracing {
@@ -27,16 +32,33 @@ const char* TRACER_CONFIGURATION_CONFIG_NAME = "tracer_configuration";
 const char* TRACE_CONTEXT_HEADER_CONFIG_NAME = "TraceContextHeaderName";
 
 const char* TracerUtil::tracer_context_header_name_;
+std::atomic<float> TracerUtil::sample_rate_(1.0f);
 
 void
-TracerUtil::InitGlobal(const std::string& config_path) {
+TracerUtil::InitGlobal(const std::string& config_path, const std::string& exporter_path) {
     if (!config_path.empty()) {
         LoadConfig(config_path);
     } else {
         tracer_context_header_name_ = "";
+        if (!exporter_path.empty()) {
+            InitExporter(exporter_path);
+        }
     }
 }
 
+void
+TracerUtil::InitExporter(const std::string& exporter_path) {
+    auto exporter = std::make_unique<SpanExporter>();
+    if (!exporter->Open(exporter_path)) {
+        std::cerr << "Failed to open span exporter " << exporter_path << ": " << std::strerror(errno) << std::endl;
+        return;
+    }
+
+    opentracing::mocktracer::MockTracerOptions tracer_options;
+    tracer_options.recorder = std::move(exporter);
+    opentracing::Tracer::InitGlobal(std::make_shared<opentracing::mocktracer::MockTracer>(std::move(tracer_options)));
+}
+
 void
 TracerUtil::LoadConfig(const std::string& config_path) {
     // Parse JSON config
@@ -77,5 +99,31 @@ TracerUtil::GetTraceContextHeaderName() {
     return tracer_context_header_name_;
 }
 
+void
+TracerUtil::SetSampleRate(float rate) {
+    sample_rate_ = rate;
+}
+
+bool
+TracerUtil::Sample() {
+    float rate = sample_rate_;
+    if (rate >= 1.0f) {
+        return true;
+    }
+    if (rate <= 0.0f) {
+        return false;
+    }
+
+    thread_local std::mt19937 generator(std::random_device{}());
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    return distribution(generator) < rate;
+}
+
+const std::shared_ptr<opentracing::Tracer>&
+TracerUtil::NoopTracer() {
+    static std::shared_ptr<opentracing::Tracer> noop_tracer = opentracing::MakeNoopTracer();
+    return noop_tracer;
+}
+
 }  // namespace tracing
 }  // namespace milvus
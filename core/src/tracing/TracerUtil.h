@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <opentracing/tracer.h>
+
+#include <atomic>
+#include <memory>
 #include <string>
 
 namespace milvus {
@@ -22,17 +26,33 @@ extern const char* TRACE_CONTEXT_HEADER_CONFIG_NAME;
 
 class TracerUtil {
  public:
+    // without a tracer library config, spans are written by the exporter if exporter_path is set
     static void
-    InitGlobal(const std::string& config_path = "");
+    InitGlobal(const std::string& config_path = "", const std::string& exporter_path = "");
 
     static std::string
     GetTraceContextHeaderName();
 
+    // the rate of requests starting a new trace, requests carrying a trace context are always traced
+    static void
+    SetSampleRate(float rate);
+
+    static bool
+    Sample();
+
+    // for the requests not sampled, its spans cost almost nothing
+    static const std::shared_ptr<opentracing::Tracer>&
+    NoopTracer();
+
  private:
     static void
     LoadConfig(const std::string& config_path);
 
+    static void
+    InitExporter(const std::string& exporter_path);
+
     static const char* tracer_context_header_name_;
+    static std::atomic<float> sample_rate_;
 };
 
 }  // namespace tracing
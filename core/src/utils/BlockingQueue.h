@@ -13,6 +13,7 @@
 
 #include <assert.h>
 #include <condition_variable>
+#include <deque>
 #include <iostream>
 #include <queue>
 #include <vector>
@@ -59,7 +60,7 @@ class BlockingQueue {
     mutable std::mutex mtx;
     std::condition_variable full_;
     std::condition_variable empty_;
-    std::queue<T> queue_;
+    std::deque<T> queue_;
     size_t capacity_ = 32;
 };
 
@@ -21,6 +21,26 @@
 namespace milvus {
 namespace server {
 
+namespace {
+const char* BASE64_CHARS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+int
+Base64Value(char c) {
+    if (c >= 'A' && c <= 'Z') {
+        return c - 'A';
+    } else if (c >= 'a' && c <= 'z') {
+        return c - 'a' + 26;
+    } else if (c >= '0' && c <= '9') {
+        return c - '0' + 52;
+    } else if (c == '+') {
+        return 62;
+    } else if (c == '/') {
+        return 63;
+    }
+    return -1;
+}
+}  // namespace
+
 void
 StringHelpFunctions::TrimStringBlank(std::string& string) {
     if (!string.empty()) {
@@ -168,5 +188,56 @@ StringHelpFunctions::ConvertToBoolean(const std::string& str, bool& value) {
     return Status::OK();
 }
 
+std::string
+StringHelpFunctions::EncodeBase64(const void* data, size_t size) {
+    auto bytes = static_cast<const uint8_t*>(data);
+    std::string result;
+    result.reserve((size + 2) / 3 * 4);
+    for (size_t i = 0; i < size; i += 3) {
+        uint32_t group = static_cast<uint32_t>(bytes[i]) << 16;
+        if (i + 1 < size) {
+            group |= static_cast<uint32_t>(bytes[i + 1]) << 8;
+        }
+        if (i + 2 < size) {
+            group |= bytes[i + 2];
+        }
+        result.push_back(BASE64_CHARS[(group >> 18) & 0x3F]);
+        result.push_back(BASE64_CHARS[(group >> 12) & 0x3F]);
+        result.push_back(i + 1 < size ? BASE64_CHARS[(group >> 6) & 0x3F] : '=');
+        result.push_back(i + 2 < size ? BASE64_CHARS[group & 0x3F] : '=');
+    }
+    return result;
+}
+
+Status
+StringHelpFunctions::DecodeBase64(const std::string& str, std::string& bytes) {
+    size_t length = str.size();
+    while (length > 0 && str[length - 1] == '=') {
+        --length;
+    }
+    if (str.size() - length > 2 || length % 4 == 1) {
+        return Status(SERVER_INVALID_ARGUMENT, "Illegal base64 string length: " + std::to_string(str.size()));
+    }
+
+    bytes.clear();
+    bytes.reserve(length * 3 / 4);
+    uint32_t group = 0;
+    int32_t bits = 0;
+    for (size_t i = 0; i < length; ++i) {
+        int value = Base64Value(str[i]);
+        if (value < 0) {
+            return Status(SERVER_INVALID_ARGUMENT, "Illegal base64 character at position " + std::to_string(i));
+        }
+        group = (group << 6) | static_cast<uint32_t>(value);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            bytes.push_back(static_cast<char>((group >> bits) & 0xFF));
+        }
+    }
+
+    return Status::OK();
+}
+
 }  // namespace server
 }  // namespace milvus
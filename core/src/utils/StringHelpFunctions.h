@@ -70,6 +70,15 @@ class StringHelpFunctions {
     // "false", "off", "no", "0", "" ==> false
     static Status
     ConvertToBoolean(const std::string& str, bool& value);
+
+    // standard base64 with '=' padding, used to carry raw vectors and results as strings
+    // "Man"  =>  "TWFu"
+    static std::string
+    EncodeBase64(const void* data, size_t size);
+
+    // the padding is optional, illegal characters or length fail
+    static Status
+    DecodeBase64(const std::string& str, std::string& bytes);
 };
 
 }  // namespace server
@@ -0,0 +1,510 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "benchmark/LoadBenchmark.h"
+
+#include <opentracing/mocktracer/tracer.h>
+
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <thread>
+#include <utility>
+
+#include "cache/CpuCacheMgr.h"
+#include "db/Constants.h"
+#include "db/DBFactory.h"
+#include "db/Utils.h"
+#include "scheduler/ResourceFactory.h"
+#include "scheduler/SchedInst.h"
+#include "utils/ThreadPool.h"
+
+namespace milvus {
+namespace benchmark {
+
+namespace {
+
+constexpr int64_t INGEST_BATCH = 10000;
+
+// fvecs: every vector is stored as an int32 dimension followed by dimension floats
+Status
+ReadFvecs(const std::string& path, int64_t max_rows, int64_t& dimension, std::vector<float>& data) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return Status(SERVER_CANNOT_OPEN_FILE, "Cannot open fvecs file: " + path);
+    }
+
+    data.clear();
+    int32_t dim = 0;
+    int64_t rows = 0;
+    while ((max_rows <= 0 || rows < max_rows) && file.read(reinterpret_cast<char*>(&dim), sizeof(dim))) {
+        if (dim <= 0 || (rows > 0 && dim != dimension)) {
+            return Status(SERVER_INVALID_ARGUMENT, "Inconsistent dimension in fvecs file: " + path);
+        }
+        dimension = dim;
+        size_t offset = data.size();
+        data.resize(offset + dim);
+        if (!file.read(reinterpret_cast<char*>(data.data() + offset), dim * sizeof(float))) {
+            return Status(SERVER_INVALID_ARGUMENT, "Truncated fvecs file: " + path);
+        }
+        ++rows;
+    }
+
+    if (rows == 0) {
+        return Status(SERVER_INVALID_ARGUMENT, "Empty fvecs file: " + path);
+    }
+    return Status::OK();
+}
+
+double
+Seconds(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+LoadBenchmark::LoadBenchmark(const BenchmarkParameters& parameters) : parameters_(parameters) {
+}
+
+Status
+LoadBenchmark::Run(milvus::json& report) {
+    report["parameters"] = {{"dataset", parameters_.dataset_.empty() ? "random" : parameters_.dataset_},
+                            {"query_set", parameters_.query_set_.empty() ? "perturbed" : parameters_.query_set_},
+                            {"index_type", engine::utils::GetIndexName(parameters_.index_type_)},
+                            {"metric_type", parameters_.metric_type_},
+                            {"index_file_size_mb", parameters_.index_file_size_},
+                            {"index_params", parameters_.index_params_},
+                            {"search_params", parameters_.search_params_},
+                            {"nq", parameters_.nq_},
+                            {"topk", parameters_.topk_},
+                            {"qps", parameters_.qps_},
+                            {"duration_seconds", parameters_.duration_},
+                            {"insert_ratio", parameters_.insert_ratio_},
+                            {"delete_ratio", parameters_.delete_ratio_},
+                            {"insert_batch", parameters_.insert_batch_},
+                            {"delete_batch", parameters_.delete_batch_},
+                            {"concurrency", parameters_.concurrency_},
+                            {"seed", parameters_.seed_}};
+
+    Status status = LoadVectors();
+    if (!status.ok()) {
+        return status;
+    }
+    report["parameters"]["dimension"] = parameters_.dimension_;
+    report["parameters"]["row_count"] = parameters_.row_count_;
+
+    status = Setup();
+    if (status.ok()) {
+        status = Ingest(report);
+    }
+    if (status.ok()) {
+        status = BuildIndex(report);
+    }
+    if (status.ok()) {
+        status = MeasureRecall(report);
+    }
+    if (status.ok()) {
+        status = RunWorkload(report);
+    }
+    TearDown();
+
+    return status;
+}
+
+Status
+LoadBenchmark::Setup() {
+    boost::filesystem::remove_all(parameters_.path_);
+
+    opentracing::mocktracer::MockTracerOptions tracer_options;
+    auto tracer = std::make_shared<opentracing::mocktracer::MockTracer>(std::move(tracer_options));
+    auto span = tracer->StartSpan("load_benchmark");
+    context_ = std::make_shared<server::Context>("load_benchmark");
+    context_->SetTraceContext(std::make_shared<tracing::TraceContext>(span));
+
+    auto res_mgr = scheduler::ResMgrInst::GetInstance();
+    res_mgr->Clear();
+    res_mgr->Add(scheduler::ResourceFactory::Create("disk", "DISK", 0, false));
+    res_mgr->Add(scheduler::ResourceFactory::Create("cpu", "CPU", 0));
+    res_mgr->Connect("disk", "cpu", scheduler::Connection("IO", 500.0));
+    res_mgr->Start();
+    scheduler::SchedInst::GetInstance()->Start();
+    scheduler::JobMgrInst::GetInstance()->Start();
+    scheduler::CPUBuilderInst::GetInstance()->Start();
+
+    auto options = engine::DBFactory::BuildOption();
+    options.meta_.path_ = parameters_.path_;
+    options.meta_.backend_uri_ = "sqlite://:@:/";
+    options.wal_enable_ = true;
+    options.mxlog_path_ = parameters_.path_ + "/wal/";
+    db_ = engine::DBFactory::Build(options);
+
+    engine::meta::CollectionSchema collection;
+    collection.collection_id_ = collection_id_;
+    collection.dimension_ = parameters_.dimension_;
+    collection.index_file_size_ = parameters_.index_file_size_ * engine::MB;
+    collection.metric_type_ = parameters_.metric_type_;
+    return db_->CreateCollection(collection);
+}
+
+void
+LoadBenchmark::TearDown() {
+    if (db_) {
+        db_->Stop();
+        db_->DropAll();
+        db_ = nullptr;
+    }
+
+    scheduler::JobMgrInst::GetInstance()->Stop();
+    scheduler::SchedInst::GetInstance()->Stop();
+    scheduler::CPUBuilderInst::GetInstance()->Stop();
+    scheduler::ResMgrInst::GetInstance()->Stop();
+    scheduler::ResMgrInst::GetInstance()->Clear();
+    cache::CpuCacheMgr::GetInstance()->ClearCache();
+
+    boost::filesystem::remove_all(parameters_.path_);
+}
+
+Status
+LoadBenchmark::LoadVectors() {
+    std::mt19937_64 rng(parameters_.seed_);
+    if (parameters_.dataset_.empty()) {
+        std::uniform_real_distribution<float> uniform(0.0, 1.0);
+        base_.resize(parameters_.row_count_ * parameters_.dimension_);
+        for (auto& value : base_) {
+            value = uniform(rng);
+        }
+    } else {
+        Status status = ReadFvecs(parameters_.dataset_, parameters_.row_count_, parameters_.dimension_, base_);
+        if (!status.ok()) {
+            return status;
+        }
+        parameters_.row_count_ = base_.size() / parameters_.dimension_;
+    }
+
+    double sum = 0.0, square_sum = 0.0;
+    for (auto value : base_) {
+        sum += value;
+        square_sum += value * value;
+    }
+    double mean = sum / base_.size();
+    noise_ = 0.05 * std::sqrt(std::max(square_sum / base_.size() - mean * mean, 0.0));
+
+    if (parameters_.query_set_.empty()) {
+        query_count_ = std::max(parameters_.recall_query_count_, parameters_.nq_);
+        queries_.resize(query_count_ * parameters_.dimension_);
+        std::uniform_int_distribution<int64_t> pick(0, parameters_.row_count_ - 1);
+        for (int64_t i = 0; i < query_count_; ++i) {
+            Perturb(base_.data() + pick(rng) * parameters_.dimension_, rng,
+                    queries_.data() + i * parameters_.dimension_);
+        }
+    } else {
+        int64_t dimension = 0;
+        Status status = ReadFvecs(parameters_.query_set_, 0, dimension, queries_);
+        if (!status.ok()) {
+            return status;
+        }
+        if (dimension != parameters_.dimension_) {
+            return Status(SERVER_INVALID_ARGUMENT, "Query set dimension differs from the dataset");
+        }
+        query_count_ = queries_.size() / dimension;
+    }
+
+    return Status::OK();
+}
+
+Status
+LoadBenchmark::Ingest(milvus::json& report) {
+    auto start = std::chrono::steady_clock::now();
+    int64_t dimension = parameters_.dimension_;
+    for (int64_t offset = 0; offset < parameters_.row_count_; offset += INGEST_BATCH) {
+        int64_t count = std::min(INGEST_BATCH, parameters_.row_count_ - offset);
+        engine::VectorsData vectors;
+        vectors.vector_count_ = count;
+        vectors.float_data_.assign(base_.begin() + offset * dimension, base_.begin() + (offset + count) * dimension);
+        vectors.id_array_.resize(count);
+        for (int64_t i = 0; i < count; ++i) {
+            vectors.id_array_[i] = offset + i;
+        }
+
+        Status status = db_->InsertVectors(collection_id_, "", vectors);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    Status status = db_->Flush(collection_id_);
+    if (!status.ok()) {
+        return status;
+    }
+    double seconds = Seconds(start);
+
+    next_id_ = parameters_.row_count_;
+    live_ids_.resize(parameters_.row_count_);
+    for (int64_t i = 0; i < parameters_.row_count_; ++i) {
+        live_ids_[i] = i;
+    }
+
+    report["ingest"] = {{"rows", parameters_.row_count_},
+                        {"seconds", seconds},
+                        {"rows_per_second", parameters_.row_count_ / seconds}};
+    return Status::OK();
+}
+
+Status
+LoadBenchmark::BuildIndex(milvus::json& report) {
+    engine::CollectionIndex index;
+    index.engine_type_ = parameters_.index_type_;
+    index.metric_type_ = parameters_.metric_type_;
+    try {
+        index.extra_params_ = milvus::json::parse(parameters_.index_params_);
+    } catch (std::exception& e) {
+        return Status(SERVER_INVALID_ARGUMENT, "Invalid index params: " + parameters_.index_params_);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    Status status = db_->CreateIndex(context_, collection_id_, index);
+    if (!status.ok()) {
+        return status;
+    }
+
+    report["index"] = {{"type", engine::utils::GetIndexName(parameters_.index_type_)}, {"seconds", Seconds(start)}};
+    return Status::OK();
+}
+
+Status
+LoadBenchmark::MeasureRecall(milvus::json& report) {
+    try {
+        search_params_ = milvus::json::parse(parameters_.search_params_);
+    } catch (std::exception& e) {
+        return Status(SERVER_INVALID_ARGUMENT, "Invalid search params: " + parameters_.search_params_);
+    }
+
+    int64_t count = std::min(parameters_.recall_query_count_, query_count_);
+    int64_t dimension = parameters_.dimension_;
+    int64_t topk = parameters_.topk_;
+    std::vector<std::vector<int64_t>> ground_truth(count);
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        BruteForce(queries_.data() + i * dimension, ground_truth[i]);
+    }
+
+    int64_t hits = 0;
+    for (int64_t offset = 0; offset < count; offset += parameters_.nq_) {
+        int64_t nq = std::min(parameters_.nq_, count - offset);
+        engine::VectorsData vectors;
+        vectors.vector_count_ = nq;
+        vectors.float_data_.assign(queries_.begin() + offset * dimension, queries_.begin() + (offset + nq) * dimension);
+
+        engine::ResultIds result_ids;
+        engine::ResultDistances result_distances;
+        Status status = db_->Query(context_, collection_id_, {}, topk, search_params_, vectors, result_ids,
+                                   result_distances);
+        if (!status.ok()) {
+            return status;
+        }
+
+        for (int64_t i = 0; i < nq; ++i) {
+            auto& truth = ground_truth[offset + i];
+            for (int64_t j = 0; j < topk && i * topk + j < (int64_t)result_ids.size(); ++j) {
+                if (std::find(truth.begin(), truth.end(), result_ids[i * topk + j]) != truth.end()) {
+                    ++hits;
+                }
+            }
+        }
+    }
+
+    report["recall"] = {{"queries", count}, {"topk", topk}, {"recall", (double)hits / (count * topk)}};
+    return Status::OK();
+}
+
+Status
+LoadBenchmark::RunWorkload(milvus::json& report) {
+    using Clock = std::chrono::steady_clock;
+
+    std::mt19937_64 rng(parameters_.seed_ + 1);
+    std::exponential_distribution<double> interval(parameters_.qps_);
+    std::uniform_real_distribution<double> pick(0.0, 1.0);
+
+    int64_t arrivals = 0;
+    auto start = Clock::now();
+    auto end = start + std::chrono::seconds(parameters_.duration_);
+    {
+        // the queue is unbounded in practice, a blocked dispatcher would turn the load into a closed loop
+        ThreadPool pool(parameters_.concurrency_, std::numeric_limits<int32_t>::max());
+        auto next = start;
+        while (true) {
+            next += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(interval(rng)));
+            if (next >= end) {
+                break;
+            }
+            std::this_thread::sleep_until(next);
+
+            double p = pick(rng);
+            OperationType type = SEARCH;
+            if (p < parameters_.insert_ratio_) {
+                type = INSERT;
+            } else if (p < parameters_.insert_ratio_ + parameters_.delete_ratio_) {
+                type = DELETE;
+            }
+
+            // latency is measured from the scheduled arrival, so queueing behind slow requests is included
+            uint64_t seed = rng();
+            pool.enqueue([this, type, seed, next]() {
+                Status status = DoOperation(type, seed);
+                double latency = std::chrono::duration<double, std::milli>(Clock::now() - next).count();
+                auto& stats = stats_[type];
+                std::lock_guard<std::mutex> lock(stats.mutex_);
+                stats.latencies_ms_.push_back(latency);
+                if (!status.ok()) {
+                    ++stats.errors_;
+                }
+            });
+            ++arrivals;
+        }
+    }
+    double elapsed = Seconds(start);
+
+    milvus::json workload;
+    workload["arrivals"] = arrivals;
+    workload["target_qps"] = parameters_.qps_;
+    workload["achieved_qps"] = arrivals / elapsed;
+    workload["elapsed_seconds"] = elapsed;
+    workload["search"] = Summarize(stats_[SEARCH], elapsed);
+    workload["insert"] = Summarize(stats_[INSERT], elapsed);
+    workload["delete"] = Summarize(stats_[DELETE], elapsed);
+    report["workload"] = workload;
+    return Status::OK();
+}
+
+Status
+LoadBenchmark::DoOperation(OperationType type, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    int64_t dimension = parameters_.dimension_;
+
+    if (type == SEARCH) {
+        std::uniform_int_distribution<int64_t> pick(0, query_count_ - 1);
+        engine::VectorsData vectors;
+        vectors.vector_count_ = parameters_.nq_;
+        vectors.float_data_.resize(parameters_.nq_ * dimension);
+        for (int64_t i = 0; i < parameters_.nq_; ++i) {
+            std::copy_n(queries_.data() + pick(rng) * dimension, dimension, vectors.float_data_.data() + i * dimension);
+        }
+
+        engine::ResultIds result_ids;
+        engine::ResultDistances result_distances;
+        return db_->Query(context_, collection_id_, {}, parameters_.topk_, search_params_, vectors, result_ids,
+                          result_distances);
+    }
+
+    if (type == INSERT) {
+        std::uniform_int_distribution<int64_t> pick(0, parameters_.row_count_ - 1);
+        int64_t count = parameters_.insert_batch_;
+        engine::VectorsData vectors;
+        vectors.vector_count_ = count;
+        vectors.float_data_.resize(count * dimension);
+        vectors.id_array_.resize(count);
+        int64_t first_id = next_id_.fetch_add(count);
+        for (int64_t i = 0; i < count; ++i) {
+            Perturb(base_.data() + pick(rng) * dimension, rng, vectors.float_data_.data() + i * dimension);
+            vectors.id_array_[i] = first_id + i;
+        }
+
+        Status status = db_->InsertVectors(collection_id_, "", vectors);
+        if (status.ok()) {
+            std::lock_guard<std::mutex> lock(live_ids_mutex_);
+            live_ids_.insert(live_ids_.end(), vectors.id_array_.begin(), vectors.id_array_.end());
+        }
+        return status;
+    }
+
+    engine::IDNumbers ids;
+    {
+        std::lock_guard<std::mutex> lock(live_ids_mutex_);
+        for (int64_t i = 0; i < parameters_.delete_batch_ && !live_ids_.empty(); ++i) {
+            std::uniform_int_distribution<size_t> pick(0, live_ids_.size() - 1);
+            size_t index = pick(rng);
+            ids.push_back(live_ids_[index]);
+            live_ids_[index] = live_ids_.back();
+            live_ids_.pop_back();
+        }
+    }
+    if (ids.empty()) {
+        return Status::OK();
+    }
+    return db_->DeleteVectors(collection_id_, "", ids);
+}
+
+void
+LoadBenchmark::Perturb(const float* vector, std::mt19937_64& rng, float* out) const {
+    std::normal_distribution<float> noise(0.0, noise_);
+    for (int64_t i = 0; i < parameters_.dimension_; ++i) {
+        out[i] = vector[i] + noise(rng);
+    }
+}
+
+void
+LoadBenchmark::BruteForce(const float* query, std::vector<int64_t>& ids) const {
+    int64_t dimension = parameters_.dimension_;
+    bool is_ip = parameters_.metric_type_ == (int64_t)engine::MetricType::IP;
+    std::vector<std::pair<float, int64_t>> distances(parameters_.row_count_);
+    for (int64_t row = 0; row < parameters_.row_count_; ++row) {
+        const float* vector = base_.data() + row * dimension;
+        float distance = 0;
+        for (int64_t i = 0; i < dimension; ++i) {
+            distance += is_ip ? -query[i] * vector[i] : (query[i] - vector[i]) * (query[i] - vector[i]);
+        }
+        distances[row] = std::make_pair(distance, row);
+    }
+
+    int64_t topk = std::min(parameters_.topk_, parameters_.row_count_);
+    std::partial_sort(distances.begin(), distances.begin() + topk, distances.end());
+    ids.resize(topk);
+    for (int64_t i = 0; i < topk; ++i) {
+        ids[i] = distances[i].second;
+    }
+}
+
+milvus::json
+LoadBenchmark::Summarize(OperationStats& stats, double elapsed_s) {
+    std::lock_guard<std::mutex> lock(stats.mutex_);
+    auto& latencies = stats.latencies_ms_;
+    std::sort(latencies.begin(), latencies.end());
+
+    auto percentile = [&latencies](double p) -> double {
+        if (latencies.empty()) {
+            return 0.0;
+        }
+        auto rank = static_cast<size_t>(std::ceil(p * latencies.size()));
+        return latencies[std::max(rank, (size_t)1) - 1];
+    };
+
+    double sum = 0.0;
+    for (auto latency : latencies) {
+        sum += latency;
+    }
+
+    milvus::json summary;
+    summary["count"] = latencies.size();
+    summary["errors"] = stats.errors_;
+    summary["throughput"] = latencies.size() / elapsed_s;
+    summary["latency_ms"] = {{"mean", latencies.empty() ? 0.0 : sum / latencies.size()},
+                             {"p50", percentile(0.5)},
+                             {"p90", percentile(0.9)},
+                             {"p99", percentile(0.99)},
+                             {"p999", percentile(0.999)},
+                             {"max", latencies.empty() ? 0.0 : latencies.back()}};
+    return summary;
+}
+
+}  // namespace benchmark
+}  // namespace milvus
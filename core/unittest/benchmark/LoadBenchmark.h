@@ -0,0 +1,129 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "db/DB.h"
+#include "server/context/Context.h"
+#include "utils/Json.h"
+#include "utils/Status.h"
+
+namespace milvus {
+namespace benchmark {
+
+struct BenchmarkParameters {
+    std::string path_ = "/tmp/milvus_benchmark";
+    std::string dataset_;    // fvecs file, random vectors are generated when empty
+    std::string query_set_;  // fvecs file, perturbed dataset vectors are used when empty
+    int64_t dimension_ = 128;
+    int64_t row_count_ = 100000;
+    int64_t index_type_ = (int64_t)engine::EngineType::FAISS_IVFSQ8;
+    int64_t metric_type_ = (int64_t)engine::MetricType::L2;
+    int64_t index_file_size_ = 1024;  // MB
+    std::string index_params_ = "{\"nlist\": 1024}";
+    std::string search_params_ = "{\"nprobe\": 16}";
+    int64_t nq_ = 1;
+    int64_t topk_ = 10;
+    int64_t recall_query_count_ = 100;
+
+    // mixed workload, arrivals are open-loop with exponential inter-arrival time
+    double qps_ = 100.0;
+    int64_t duration_ = 30;  // seconds
+    double insert_ratio_ = 0.1;
+    double delete_ratio_ = 0.05;
+    int64_t insert_batch_ = 100;
+    int64_t delete_batch_ = 10;
+    int64_t concurrency_ = 32;
+
+    uint64_t seed_ = 42;
+    std::string output_;  // json report file, stdout when empty
+};
+
+// Runs an in-process DBImpl (sqlite meta, local disk) through ingestion, index building, a recall check against
+// brute force and a mixed insert/delete/search workload at a target QPS.
+class LoadBenchmark {
+ public:
+    explicit LoadBenchmark(const BenchmarkParameters& parameters);
+
+    Status
+    Run(milvus::json& report);
+
+ private:
+    enum OperationType { SEARCH = 0, INSERT, DELETE, OPERATION_COUNT };
+
+    struct OperationStats {
+        std::mutex mutex_;
+        std::vector<double> latencies_ms_;
+        int64_t errors_ = 0;
+    };
+
+    Status
+    Setup();
+
+    void
+    TearDown();
+
+    Status
+    LoadVectors();
+
+    Status
+    Ingest(milvus::json& report);
+
+    Status
+    BuildIndex(milvus::json& report);
+
+    Status
+    MeasureRecall(milvus::json& report);
+
+    Status
+    RunWorkload(milvus::json& report);
+
+    Status
+    DoOperation(OperationType type, uint64_t seed);
+
+    void
+    Perturb(const float* vector, std::mt19937_64& rng, float* out) const;
+
+    void
+    BruteForce(const float* query, std::vector<int64_t>& ids) const;
+
+    static milvus::json
+    Summarize(OperationStats& stats, double elapsed_s);
+
+ private:
+    BenchmarkParameters parameters_;
+    std::string collection_id_ = "load_benchmark";
+    std::shared_ptr<server::Context> context_;
+    engine::DBPtr db_;
+    milvus::json search_params_;
+
+    std::vector<float> base_;
+    std::vector<float> queries_;
+    int64_t query_count_ = 0;
+    float noise_ = 0.0;  // stddev of the noise added to dataset vectors to generate queries and inserts
+
+    std::atomic<int64_t> next_id_{0};
+    std::mutex live_ids_mutex_;
+    std::vector<int64_t> live_ids_;
+
+    OperationStats stats_[OPERATION_COUNT];
+};
+
+}  // namespace benchmark
+}  // namespace milvus
@@ -0,0 +1,193 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <fiu-local.h>
+#include <getopt.h>
+#include <libgen.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "benchmark/LoadBenchmark.h"
+#include "easyloggingpp/easylogging++.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+void
+print_help(const std::string& app_name);
+
+int
+main(int argc, char* argv[]) {
+    std::string app_name = basename(argv[0]);
+    static struct option long_options[] = {{"path", required_argument, nullptr, 'p'},
+                                           {"dataset", required_argument, nullptr, 'D'},
+                                           {"query_set", required_argument, nullptr, 'Q'},
+                                           {"dimension", required_argument, nullptr, 'd'},
+                                           {"rowcount", required_argument, nullptr, 'r'},
+                                           {"index", required_argument, nullptr, 'i'},
+                                           {"metric", required_argument, nullptr, 'm'},
+                                           {"index_file_size", required_argument, nullptr, 'f'},
+                                           {"index_params", required_argument, nullptr, 'I'},
+                                           {"search_params", required_argument, nullptr, 'S'},
+                                           {"nq", required_argument, nullptr, 'n'},
+                                           {"topk", required_argument, nullptr, 'k'},
+                                           {"recall_queries", required_argument, nullptr, 'R'},
+                                           {"qps", required_argument, nullptr, 'q'},
+                                           {"duration", required_argument, nullptr, 't'},
+                                           {"insert_ratio", required_argument, nullptr, 'a'},
+                                           {"delete_ratio", required_argument, nullptr, 'x'},
+                                           {"insert_batch", required_argument, nullptr, 'b'},
+                                           {"delete_batch", required_argument, nullptr, 'e'},
+                                           {"concurrency", required_argument, nullptr, 'c'},
+                                           {"seed", required_argument, nullptr, 's'},
+                                           {"output", required_argument, nullptr, 'o'},
+                                           {"help", no_argument, nullptr, 'h'},
+                                           {nullptr, 0, nullptr, 0}};
+
+    milvus::benchmark::BenchmarkParameters parameters;
+    int option_index = 0;
+    int value;
+    while ((value = getopt_long(argc, argv, "p:D:Q:d:r:i:m:f:I:S:n:k:R:q:t:a:x:b:e:c:s:o:h", long_options,
+                                &option_index)) != -1) {
+        switch (value) {
+            case 'p':
+                parameters.path_ = optarg;
+                break;
+            case 'D':
+                parameters.dataset_ = optarg;
+                break;
+            case 'Q':
+                parameters.query_set_ = optarg;
+                break;
+            case 'd':
+                parameters.dimension_ = atol(optarg);
+                break;
+            case 'r':
+                parameters.row_count_ = atol(optarg);
+                break;
+            case 'i':
+                parameters.index_type_ = atol(optarg);
+                break;
+            case 'm':
+                parameters.metric_type_ = atol(optarg);
+                break;
+            case 'f':
+                parameters.index_file_size_ = atol(optarg);
+                break;
+            case 'I':
+                parameters.index_params_ = optarg;
+                break;
+            case 'S':
+                parameters.search_params_ = optarg;
+                break;
+            case 'n':
+                parameters.nq_ = atol(optarg);
+                break;
+            case 'k':
+                parameters.topk_ = atol(optarg);
+                break;
+            case 'R':
+                parameters.recall_query_count_ = atol(optarg);
+                break;
+            case 'q':
+                parameters.qps_ = atof(optarg);
+                break;
+            case 't':
+                parameters.duration_ = atol(optarg);
+                break;
+            case 'a':
+                parameters.insert_ratio_ = atof(optarg);
+                break;
+            case 'x':
+                parameters.delete_ratio_ = atof(optarg);
+                break;
+            case 'b':
+                parameters.insert_batch_ = atol(optarg);
+                break;
+            case 'e':
+                parameters.delete_batch_ = atol(optarg);
+                break;
+            case 'c':
+                parameters.concurrency_ = atol(optarg);
+                break;
+            case 's':
+                parameters.seed_ = strtoull(optarg, nullptr, 10);
+                break;
+            case 'o':
+                parameters.output_ = optarg;
+                break;
+            case 'h':
+            default:
+                print_help(app_name);
+                return EXIT_SUCCESS;
+        }
+    }
+
+    if (parameters.dimension_ <= 0 || parameters.row_count_ <= 0 || parameters.nq_ <= 0 || parameters.topk_ <= 0 ||
+        parameters.qps_ <= 0 || parameters.concurrency_ <= 0 || parameters.insert_batch_ <= 0 ||
+        parameters.insert_ratio_ < 0 || parameters.delete_ratio_ < 0 ||
+        parameters.insert_ratio_ + parameters.delete_ratio_ > 1.0) {
+        std::cerr << "Invalid parameters" << std::endl;
+        print_help(app_name);
+        return EXIT_FAILURE;
+    }
+
+    fiu_init(0);
+
+    milvus::json report;
+    milvus::benchmark::LoadBenchmark benchmark(parameters);
+    auto status = benchmark.Run(report);
+    if (!status.ok()) {
+        std::cerr << "Benchmark failed: " << status.message() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (parameters.output_.empty()) {
+        std::cout << report.dump(4) << std::endl;
+    } else {
+        std::ofstream file(parameters.output_);
+        file << report.dump(4) << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
+
+void
+print_help(const std::string& app_name) {
+    printf("\n Usage: %s [OPTIONS]\n\n", app_name.c_str());
+    printf("  Options:\n");
+    printf("   -p --path             Storage path of the in-process db, default:/tmp/milvus_benchmark\n");
+    printf("   -D --dataset          fvecs file to ingest, default: random vectors\n");
+    printf("   -Q --query_set        fvecs file of query vectors, default: perturbed dataset vectors\n");
+    printf("   -d --dimension        Vector dimension of random vectors, default:128\n");
+    printf("   -r --rowcount         Number of vectors to ingest, default:100000\n");
+    printf("   -i --index            "
+           "Index type(1=IDMAP, 2=IVFLAT, 3=IVFSQ8, 6=IVFPQ, 11=HNSW, 12=ANNOY), default:3\n");
+    printf("   -m --metric           Metric type(1=L2, 2=IP), default:1\n");
+    printf("   -f --index_file_size  Collection index file size(unit:MB), default:1024\n");
+    printf("   -I --index_params     Index params in json, default:{\"nlist\": 1024}\n");
+    printf("   -S --search_params    Search params in json, default:{\"nprobe\": 16}\n");
+    printf("   -n --nq               nq of each search, default:1\n");
+    printf("   -k --topk             topk of each search, default:10\n");
+    printf("   -R --recall_queries   Number of queries checked against brute force, default:100\n");
+    printf("   -q --qps              Target operations per second of the mixed workload, default:100\n");
+    printf("   -t --duration         Duration of the mixed workload(unit:second), default:30\n");
+    printf("   -a --insert_ratio     Fraction of insert operations, default:0.1\n");
+    printf("   -x --delete_ratio     Fraction of delete operations, default:0.05\n");
+    printf("   -b --insert_batch     Vectors per insert, default:100\n");
+    printf("   -e --delete_batch     Ids per delete, default:10\n");
+    printf("   -c --concurrency      Client threads executing the operations, default:32\n");
+    printf("   -s --seed             Random seed, default:42\n");
+    printf("   -o --output           Json report file, default: stdout\n");
+    printf("   -h --help             Print help information\n");
+    printf("\n");
+}
@@ -0,0 +1,188 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <boost/filesystem.hpp>
+
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "db/Options.h"
+#include "db/insert/MemTable.h"
+#include "db/insert/VectorSource.h"
+#include "db/meta/SqliteMetaImpl.h"
+#include "db/wal/WalBuffer.h"
+
+namespace {
+
+constexpr int64_t DIMENSION = 128;
+const char* COLLECTION_ID = "micro_benchmark";
+const char* DB_PATH = "/tmp/milvus_micro_benchmark/db";
+const char* WAL_PATH = "/tmp/milvus_micro_benchmark/wal/";  // end with '/'
+
+// a collection with one flushed segment of rows vectors, the ids are 0 .. rows - 1
+class SegmentFixture {
+ public:
+    explicit SegmentFixture(int64_t rows) : rows_(rows) {
+        options_.meta_.path_ = DB_PATH;
+        options_.meta_.backend_uri_ = "sqlite://:@:/";
+    }
+
+    ~SegmentFixture() {
+        mem_table_ = nullptr;
+        meta_ = nullptr;
+        boost::filesystem::remove_all(DB_PATH);
+    }
+
+    void
+    Build() {
+        mem_table_ = nullptr;
+        meta_ = nullptr;
+        boost::filesystem::remove_all(DB_PATH);
+
+        meta_ = std::make_shared<milvus::engine::meta::SqliteMetaImpl>(options_.meta_);
+        milvus::engine::meta::CollectionSchema collection;
+        collection.collection_id_ = COLLECTION_ID;
+        collection.dimension_ = DIMENSION;
+        collection.engine_type_ = (int32_t)milvus::engine::EngineType::FAISS_IDMAP;
+        meta_->CreateCollection(collection);
+
+        milvus::engine::VectorsData vectors;
+        vectors.vector_count_ = rows_;
+        vectors.float_data_.assign(rows_ * DIMENSION, 0.5);
+        vectors.id_array_.resize(rows_);
+        std::iota(vectors.id_array_.begin(), vectors.id_array_.end(), 0);
+
+        mem_table_ = std::make_shared<milvus::engine::MemTable>(COLLECTION_ID, meta_, options_);
+        mem_table_->Add(std::make_shared<milvus::engine::VectorSource>(vectors));
+        mem_table_->Serialize(0);
+    }
+
+    std::shared_ptr<milvus::engine::MemTable>&
+    mem_table() {
+        return mem_table_;
+    }
+
+ private:
+    int64_t rows_;
+    milvus::engine::DBOptions options_;
+    milvus::engine::meta::MetaPtr meta_;
+    std::shared_ptr<milvus::engine::MemTable> mem_table_;
+};
+
+struct WalFixture {
+    explicit WalFixture(int64_t batch) : buffer_(WAL_PATH, 64), ids_(batch), data_(batch * DIMENSION, 0.5) {
+        boost::filesystem::remove_all(WAL_PATH);
+        boost::filesystem::create_directories(WAL_PATH);
+        buffer_.Reset(0);
+
+        std::iota(ids_.begin(), ids_.end(), 0);
+        record_.type = milvus::engine::wal::MXLogType::InsertVector;
+        record_.collection_id = COLLECTION_ID;
+        record_.length = batch;
+        record_.ids = ids_.data();
+        record_.data_size = data_.size() * sizeof(float);
+        record_.data = data_.data();
+    }
+
+    ~WalFixture() {
+        boost::filesystem::remove_all(WAL_PATH);
+    }
+
+    int64_t
+    RecordBytes() const {
+        return ids_.size() * sizeof(milvus::engine::IDNumber) + record_.data_size;
+    }
+
+    milvus::engine::wal::MXLogBuffer buffer_;
+    std::vector<milvus::engine::IDNumber> ids_;
+    std::vector<float> data_;
+    milvus::engine::wal::MXLogRecord record_;
+    milvus::engine::wal::MXLogRecord read_;
+};
+
+}  // namespace
+
+// ApplyDeletes is private, it is measured through Serialize() of a mem table holding nothing but deletes
+static void
+BM_MemTableApplyDeletes(benchmark::State& state) {
+    int64_t rows = state.range(0);
+    int64_t delete_count = state.range(1);
+
+    SegmentFixture fixture(rows);
+    fixture.Build();
+    int64_t next_id = 0;
+    uint64_t lsn = 1;
+    for (auto _ : state) {
+        state.PauseTiming();
+        if (next_id + delete_count > rows) {
+            fixture.Build();
+            next_id = 0;
+        }
+        std::vector<milvus::segment::doc_id_t> ids(delete_count);
+        std::iota(ids.begin(), ids.end(), next_id);
+        next_id += delete_count;
+        fixture.mem_table()->Delete(ids);
+        state.ResumeTiming();
+
+        fixture.mem_table()->Serialize(lsn++, true);
+    }
+    state.SetItemsProcessed(state.iterations() * delete_count);
+}
+BENCHMARK(BM_MemTableApplyDeletes)
+    ->ArgNames({"rows", "delete"})
+    ->Args({100000, 10})
+    ->Args({100000, 1000})
+    ->Args({1000000, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+static void
+BM_WalAppend(benchmark::State& state) {
+    WalFixture fixture(state.range(0));
+    for (auto _ : state) {
+        if (fixture.buffer_.Append(fixture.record_) != milvus::WAL_SUCCESS) {
+            state.SkipWithError("append failed");
+            break;
+        }
+
+        state.PauseTiming();
+        fixture.buffer_.Next(fixture.record_.lsn, fixture.read_);
+        fixture.buffer_.RemoveOldFiles(fixture.record_.lsn);
+        state.ResumeTiming();
+    }
+    state.SetBytesProcessed(state.iterations() * fixture.RecordBytes());
+}
+BENCHMARK(BM_WalAppend)->ArgName("batch")->Arg(1)->Arg(100)->Arg(10000);
+
+static void
+BM_WalNext(benchmark::State& state) {
+    WalFixture fixture(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto error_code = fixture.buffer_.Append(fixture.record_);
+        state.ResumeTiming();
+        if (error_code != milvus::WAL_SUCCESS) {
+            state.SkipWithError("append failed");
+            break;
+        }
+
+        fixture.buffer_.Next(fixture.record_.lsn, fixture.read_);
+
+        state.PauseTiming();
+        fixture.buffer_.RemoveOldFiles(fixture.record_.lsn);
+        state.ResumeTiming();
+    }
+    state.SetBytesProcessed(state.iterations() * fixture.RecordBytes());
+}
+BENCHMARK(BM_WalNext)->ArgName("batch")->Arg(1)->Arg(100)->Arg(10000);
@@ -0,0 +1,69 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+#include "scheduler/task/SearchTask.h"
+
+namespace {
+
+// nq sorted result lists of k entries, as a search task produces them
+void
+BuildResult(size_t nq, size_t k, std::mt19937_64& rng, milvus::scheduler::ResultIds& ids,
+            milvus::scheduler::ResultDistances& distances) {
+    std::uniform_real_distribution<float> distance(0.0, 100.0);
+    ids.resize(nq * k);
+    distances.resize(nq * k);
+    for (size_t i = 0; i < nq * k; ++i) {
+        ids[i] = rng() >> 1;
+        distances[i] = distance(rng);
+    }
+    for (size_t i = 0; i < nq; ++i) {
+        std::sort(distances.begin() + i * k, distances.begin() + (i + 1) * k);
+    }
+}
+
+}  // namespace
+
+static void
+BM_MergeTopkToResultSet(benchmark::State& state) {
+    size_t nq = state.range(0);
+    size_t topk = state.range(1);
+
+    std::mt19937_64 rng(42);
+    milvus::scheduler::ResultIds src_ids, tar_ids;
+    milvus::scheduler::ResultDistances src_distances, tar_distances;
+    BuildResult(nq, topk, rng, src_ids, src_distances);
+    BuildResult(nq, topk, rng, tar_ids, tar_distances);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto ids = tar_ids;
+        auto distances = tar_distances;
+        state.ResumeTiming();
+
+        milvus::scheduler::XSearchTask::MergeTopkToResultSet(src_ids, src_distances, topk, nq, topk, true, ids,
+                                                             distances);
+        benchmark::DoNotOptimize(ids.data());
+    }
+    state.SetItemsProcessed(state.iterations() * nq * topk);
+}
+BENCHMARK(BM_MergeTopkToResultSet)
+    ->ArgNames({"nq", "topk"})
+    ->Args({1, 10})
+    ->Args({1, 1000})
+    ->Args({100, 10})
+    ->Args({100, 1000})
+    ->Args({1000, 100})
+    ->Args({10, 16384});
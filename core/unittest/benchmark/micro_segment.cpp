@@ -0,0 +1,183 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <boost/filesystem.hpp>
+#include <faiss/utils/ConcurrentBitset.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "codecs/default/DefaultIdBloomFilterFormat.h"
+#include "codecs/default/DefaultVectorsFormat.h"
+#include "segment/IdBloomFilter.h"
+#include "segment/Vectors.h"
+#include "storage/FSHandler.h"
+
+namespace {
+
+constexpr int64_t DIMENSION = 128;
+const char* SEGMENT_PATH = "/tmp/milvus_micro_benchmark/segment";
+
+milvus::segment::VectorsPtr
+BuildVectors(int64_t count, std::mt19937_64& rng) {
+    std::uniform_real_distribution<float> value(0.0, 1.0);
+    std::vector<float> data(count * DIMENSION);
+    for (auto& v : data) {
+        v = value(rng);
+    }
+    std::vector<milvus::segment::doc_id_t> uids(count);
+    for (int64_t i = 0; i < count; ++i) {
+        uids[i] = i;
+    }
+
+    auto vectors = std::make_shared<milvus::segment::Vectors>();
+    vectors->SetName("micro_benchmark");
+    vectors->AddData(reinterpret_cast<const uint8_t*>(data.data()), data.size() * sizeof(float));
+    vectors->AddUids(uids);
+    return vectors;
+}
+
+}  // namespace
+
+static void
+BM_VectorsErase(benchmark::State& state) {
+    int64_t count = state.range(0);
+    int64_t erase_count = state.range(1);
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int32_t> offset(0, count - 1);
+    auto source = BuildVectors(count, rng);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        milvus::segment::Vectors vectors;
+        vectors.AddData(source->GetData());
+        vectors.AddUids(source->GetUids());
+        std::vector<int32_t> offsets(erase_count);
+        for (auto& o : offsets) {
+            o = offset(rng);
+        }
+        state.ResumeTiming();
+
+        vectors.Erase(offsets);
+        benchmark::DoNotOptimize(vectors.GetData().data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_VectorsErase)
+    ->ArgNames({"rows", "erase"})
+    ->Args({10000, 10})
+    ->Args({100000, 10})
+    ->Args({100000, 1000})
+    ->Args({1000000, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+static void
+BM_IdBloomFilterCheck(benchmark::State& state) {
+    int64_t count = state.range(0);
+
+    milvus::segment::IdBloomFilterPtr bloom_filter;
+    milvus::codec::DefaultIdBloomFilterFormat format;
+    format.create(count, bloom_filter);
+    std::vector<milvus::segment::doc_id_t> uids(count);
+    for (int64_t i = 0; i < count; ++i) {
+        uids[i] = i * 2;
+    }
+    bloom_filter->Add(uids);
+
+    // half of the checked ids are in the filter
+    milvus::segment::doc_id_t uid = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bloom_filter->Check(uid));
+        uid = (uid + 1) % (count * 2);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IdBloomFilterCheck)->ArgName("rows")->Arg(10000)->Arg(1000000)->Arg(10000000);
+
+static void
+BM_DefaultVectorsFormatWrite(benchmark::State& state) {
+    int64_t count = state.range(0);
+
+    boost::filesystem::remove_all(SEGMENT_PATH);
+    boost::filesystem::create_directories(SEGMENT_PATH);
+    std::mt19937_64 rng(42);
+    auto vectors = BuildVectors(count, rng);
+    auto fs_ptr = milvus::storage::createFsHandler(SEGMENT_PATH);
+    milvus::codec::DefaultVectorsFormat format;
+
+    for (auto _ : state) {
+        format.write(fs_ptr, vectors);
+    }
+    state.SetBytesProcessed(state.iterations() * (vectors->GetData().size() + count * sizeof(int64_t)));
+    boost::filesystem::remove_all(SEGMENT_PATH);
+}
+BENCHMARK(BM_DefaultVectorsFormatWrite)
+    ->ArgName("rows")
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+static void
+BM_DefaultVectorsFormatRead(benchmark::State& state) {
+    int64_t count = state.range(0);
+
+    boost::filesystem::remove_all(SEGMENT_PATH);
+    boost::filesystem::create_directories(SEGMENT_PATH);
+    std::mt19937_64 rng(42);
+    auto vectors = BuildVectors(count, rng);
+    auto fs_ptr = milvus::storage::createFsHandler(SEGMENT_PATH);
+    milvus::codec::DefaultVectorsFormat format;
+    format.write(fs_ptr, vectors);
+
+    for (auto _ : state) {
+        auto vectors_read = std::make_shared<milvus::segment::Vectors>();
+        format.read(fs_ptr, vectors_read);
+        benchmark::DoNotOptimize(vectors_read->GetData().data());
+    }
+    state.SetBytesProcessed(state.iterations() * (vectors->GetData().size() + count * sizeof(int64_t)));
+    boost::filesystem::remove_all(SEGMENT_PATH);
+}
+BENCHMARK(BM_DefaultVectorsFormatRead)
+    ->ArgName("rows")
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+static void
+BM_ConcurrentBitsetTest(benchmark::State& state) {
+    int64_t count = state.range(0);
+
+    // one in ten ids deleted, at random positions
+    faiss::ConcurrentBitset bitset(count);
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int64_t> id(0, count - 1);
+    for (int64_t i = 0; i < count / 10; ++i) {
+        bitset.set(id(rng));
+    }
+
+    for (auto _ : state) {
+        int64_t deleted = 0;
+        for (int64_t i = 0; i < count; ++i) {
+            deleted += bitset.test(i);
+        }
+        benchmark::DoNotOptimize(deleted);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ConcurrentBitsetTest)->ArgName("rows")->Arg(10000)->Arg(1000000)->Arg(10000000);
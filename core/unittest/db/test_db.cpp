@@ -18,13 +18,17 @@
 #include <thread>
 
 #include "cache/CpuCacheMgr.h"
+#include "cache/QueryCacheMgr.h"
 #include "config/Config.h"
 #include "db/Constants.h"
 #include "db/DB.h"
 #include "db/DBFactory.h"
 #include "db/DBImpl.h"
 #include "db/IDGenerator.h"
+#include "db/RecallSampler.h"
+#include "db/SearchTuner.h"
 #include "db/meta/MetaConsts.h"
+#include "db/meta/MetaFactory.h"
 #include "db/utils.h"
 #include <faiss/IndexFlat.h>
 #include "index/knowhere/knowhere/index/vector_index/IndexIDMAP.h"
@@ -350,6 +354,50 @@ TEST_F(DBTest, SEARCH_TEST) {
         ASSERT_TRUE(stat.ok());
     }
 
+    {  // search several collections at once, a failed collection doesn't fail the others
+        milvus::engine::meta::CollectionSchema other_info = BuildCollectionSchema();
+        other_info.collection_id_ = std::string(COLLECTION_NAME) + "_multi";
+        stat = db_->CreateCollection(other_info);
+        ASSERT_TRUE(stat.ok());
+        milvus::engine::VectorsData other_xb;
+        BuildVectors(nb, 1, other_xb);  // ids differ from the first collection
+        stat = db_->InsertVectors(other_info.collection_id_, "", other_xb);
+        ASSERT_TRUE(stat.ok());
+        stat = db_->Flush(other_info.collection_id_);
+        ASSERT_TRUE(stat.ok());
+
+        std::vector<milvus::engine::CollectionQuery> queries(3);
+        queries[0].collection_id_ = COLLECTION_NAME;
+        queries[0].k_ = k;
+        queries[0].extra_params_ = json_params;
+        queries[0].vectors_ = xq;
+        queries[1] = queries[0];
+        queries[1].collection_id_ = other_info.collection_id_;
+        queries[2] = queries[0];
+        queries[2].collection_id_ = "not_exist_collection";
+        stat = db_->QueryMulti(dummy_context_, queries);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_FALSE(queries[2].status_.ok());
+
+        // every collection gets the same result as searching it alone
+        for (size_t i = 0; i < 2; i++) {
+            ASSERT_TRUE(queries[i].status_.ok());
+            std::vector<std::string> tags;
+            milvus::engine::ResultIds result_ids;
+            milvus::engine::ResultDistances result_distances;
+            stat = db_->Query(dummy_context_, queries[i].collection_id_, tags, k, json_params, xq, result_ids,
+                              result_distances);
+            ASSERT_TRUE(stat.ok());
+            ASSERT_EQ(result_ids.size(), nq * k);
+            ASSERT_EQ(queries[i].result_ids_, result_ids);
+            ASSERT_EQ(queries[i].result_distances_.size(), result_distances.size());
+            for (size_t j = 0; j < result_distances.size(); j++) {
+                ASSERT_FLOAT_EQ(queries[i].result_distances_[j], result_distances[j]);
+            }
+        }
+        ASSERT_NE(queries[0].result_ids_, queries[1].result_ids_);
+    }
+
 #ifdef MILVUS_GPU_VERSION
     index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFSQ8H;
     db_->CreateIndex(dummy_context_, COLLECTION_NAME, index);  // wait until build index finish
@@ -1404,6 +1452,193 @@ TEST_F(DBTest2, INSERT_DUPLICATE_ID) {
     ASSERT_TRUE(stat.ok());
 }
 
+TEST_F(DBTest2, RECALL_SAMPLE_TEST) {
+    milvus::engine::meta::CollectionSchema collection_schema = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_schema);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nb = 1000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, 0, xb);
+    stat = db_->InsertVectors(COLLECTION_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush(COLLECTION_NAME);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nq = 5, k = 10;
+    milvus::engine::VectorsData xq;
+    BuildVectors(nq, 1, xq);
+    std::vector<std::string> tags;
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(dummy_context_, COLLECTION_NAME, tags, k, milvus::json(), xq, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+
+    auto meta = milvus::engine::MetaFactory::Build(GetOptions().meta_, milvus::engine::DBOptions::MODE::SINGLE);
+    milvus::engine::meta::FilesHolder files_holder;
+    stat = meta->FilesToSearch(COLLECTION_NAME, files_holder);
+    ASSERT_TRUE(stat.ok());
+    auto& files = files_holder.HoldFiles();
+    ASSERT_FALSE(files.empty());
+
+    // raw files are searched by brute force, so the results are exact
+    double recall = 0.0;
+    stat = milvus::engine::RecallSampler::Evaluate(files, k, xq, result_ids, recall);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_DOUBLE_EQ(recall, 1.0);
+
+    milvus::engine::ResultIds missed_ids(nq * k, -1);
+    stat = milvus::engine::RecallSampler::Evaluate(files, k, xq, missed_ids, recall);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_DOUBLE_EQ(recall, 0.0);
+
+    stat = milvus::engine::RecallSampler::Evaluate({}, k, xq, result_ids, recall);
+    ASSERT_FALSE(stat.ok());
+
+    // a sampled search is evaluated on the background lane
+    milvus::engine::RecallSampler sampler(1.0);
+    ASSERT_TRUE(sampler.Sample());
+    sampler.Submit(COLLECTION_NAME, collection_schema.engine_type_, files, k, xq, result_ids);
+    ASSERT_FALSE(milvus::engine::RecallSampler(0.0).Sample());
+}
+
+TEST_F(DBTest2, QUERY_CACHE_TEST) {
+    milvus::engine::meta::CollectionSchema collection_schema = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_schema);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nb = 1000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, 0, xb);
+    stat = db_->InsertVectors(COLLECTION_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush(COLLECTION_NAME);
+    ASSERT_TRUE(stat.ok());
+
+    // the query cache is resized in service
+    auto query_cache = milvus::cache::QueryCacheMgr::GetInstance();
+    auto& config = milvus::server::Config::GetInstance();
+    ASSERT_TRUE(config.SetCacheConfigQueryCacheSize("0").ok());
+    ASSERT_FALSE(query_cache->Enabled());
+    ASSERT_TRUE(config.SetCacheConfigQueryCacheSize("104857600").ok());
+    ASSERT_TRUE(query_cache->Enabled());
+    ASSERT_EQ(query_cache->CacheCapacity(), 104857600);
+
+    uint64_t nq = 5, k = 10;
+    milvus::engine::VectorsData xq;
+    BuildVectors(nq, 1, xq);
+    std::vector<std::string> tags;
+    milvus::engine::ResultIds result_ids, cached_ids;
+    milvus::engine::ResultDistances result_distances, cached_distances;
+    stat = db_->Query(dummy_context_, COLLECTION_NAME, tags, k, milvus::json(), xq, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+
+    // the repeated query is answered from the cache
+    auto hit_count = query_cache->HitCount();
+    stat = db_->Query(dummy_context_, COLLECTION_NAME, tags, k, milvus::json(), xq, cached_ids, cached_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(query_cache->HitCount(), hit_count + 1);
+    ASSERT_EQ(cached_ids, result_ids);
+    ASSERT_EQ(cached_distances, result_distances);
+
+    // new files change the key of the query, it misses the cache
+    BuildVectors(nb, 2, xb);
+    stat = db_->InsertVectors(COLLECTION_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush(COLLECTION_NAME);
+    ASSERT_TRUE(stat.ok());
+
+    hit_count = query_cache->HitCount();
+    stat = db_->Query(dummy_context_, COLLECTION_NAME, tags, k, milvus::json(), xq, cached_ids, cached_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(query_cache->HitCount(), hit_count);
+    ASSERT_EQ(cached_ids.size(), nq * k);
+
+    // disabled in service, no lookup at all
+    ASSERT_TRUE(config.SetCacheConfigQueryCacheSize("0").ok());
+    ASSERT_FALSE(query_cache->Enabled());
+    auto miss_count = query_cache->MissCount();
+    stat = db_->Query(dummy_context_, COLLECTION_NAME, tags, k, milvus::json(), xq, cached_ids, cached_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(query_cache->HitCount(), hit_count);
+    ASSERT_EQ(query_cache->MissCount(), miss_count);
+}
+
+TEST_F(DBTest2, SEARCH_TUNE_TEST) {
+    milvus::engine::meta::CollectionSchema collection_schema = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_schema);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::VectorsData xb;
+    BuildVectors(VECTOR_COUNT, 0, xb);
+    stat = db_->InsertVectors(COLLECTION_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush(COLLECTION_NAME);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::CollectionIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFFLAT;
+    index.extra_params_ = {{"nlist", 16}};
+    stat = db_->CreateIndex(dummy_context_, COLLECTION_NAME, index);
+    ASSERT_TRUE(stat.ok());
+
+    auto meta = milvus::engine::MetaFactory::Build(GetOptions().meta_, milvus::engine::DBOptions::MODE::SINGLE);
+    milvus::engine::meta::FilesHolder files_holder;
+    stat = meta->FilesToSearch(COLLECTION_NAME, files_holder);
+    ASSERT_TRUE(stat.ok());
+    milvus::engine::meta::SegmentsSchema index_files;
+    for (auto& file : files_holder.HoldFiles()) {
+        if (file.segment_id_ != file.file_id_) {
+            index_files.push_back(file);
+        }
+    }
+    ASSERT_FALSE(index_files.empty());
+
+    uint64_t nq = 16, k = 10;
+    milvus::engine::VectorsData xq;
+    BuildVectors(nq, 1, xq);
+
+    std::vector<milvus::engine::SearchTuner::OperatingPoint> curve;
+    int64_t value = -1;
+    stat = milvus::engine::SearchTuner::Tune(index_files, k, xq, 0.9, 0, curve, value);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_FALSE(curve.empty());
+    ASSERT_GE(value, 1);
+    ASSERT_LE(value, 16);
+
+    // probing all the lists is exhaustive
+    stat = milvus::engine::SearchTuner::Tune(index_files, k, xq, 1.0, 0, curve, value);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_GE(curve.back().recall_, 0.99);
+
+    stat = milvus::engine::SearchTuner::Tune({}, k, xq, 0.9, 0, curve, value);
+    ASSERT_FALSE(stat.ok());
+    ASSERT_EQ(milvus::engine::SearchTuner::ParamName((int32_t)milvus::engine::EngineType::HNSW), "ef");
+    ASSERT_TRUE(milvus::engine::SearchTuner::ParamName((int32_t)milvus::engine::EngineType::FAISS_IDMAP).empty());
+
+    // the searches of a collection are sampled and tuned on the background lane
+    auto ivf = (int32_t)milvus::engine::EngineType::FAISS_IVFFLAT;
+    milvus::engine::SearchTuner tuner(0.9, 0);
+    milvus::json params;
+    ASSERT_FALSE(tuner.Fill(COLLECTION_NAME, ivf, k, params));
+    tuner.Observe(COLLECTION_NAME, files_holder.HoldFiles(), k, xq);
+    for (int i = 0; i < 100 && !tuner.Dump(COLLECTION_NAME)["tuned"].get<bool>(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    ASSERT_TRUE(tuner.Fill(COLLECTION_NAME, ivf, k, params));
+    ASSERT_TRUE(params.contains("nprobe"));
+
+    milvus::json user_params = {{"nprobe", 7}};
+    ASSERT_FALSE(tuner.Fill(COLLECTION_NAME, ivf, k, user_params));
+    ASSERT_EQ(user_params["nprobe"].get<int64_t>(), 7);
+    milvus::json hnsw_params;
+    ASSERT_FALSE(tuner.Fill(COLLECTION_NAME, (int32_t)milvus::engine::EngineType::HNSW, k, hnsw_params));
+
+    tuner.Remove(COLLECTION_NAME);
+    milvus::json removed_params;
+    ASSERT_FALSE(tuner.Fill(COLLECTION_NAME, ivf, k, removed_params));
+}
+
 /*
 TEST_F(DBTest2, SEARCH_WITH_DIFFERENT_INDEX) {
     milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
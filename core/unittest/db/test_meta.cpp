@@ -11,6 +11,7 @@
 
 #include "db/Constants.h"
 #include "db/Utils.h"
+#include "db/meta/CachedMetaImpl.h"
 #include "db/meta/MetaConsts.h"
 #include "db/meta/SqliteMetaImpl.h"
 #include "db/utils.h"
@@ -766,3 +767,67 @@ TEST_F(MetaTest, LSN_TEST) {
     status = impl_->GetGlobalLastLSN(temp_lsb);
     ASSERT_EQ(temp_lsb, lsn);
 }
+
+TEST_F(MetaTest, META_CACHE_TEST) {
+    auto collection_id = "meta_cache_test";
+    auto cached = std::make_shared<milvus::engine::meta::CachedMetaImpl>(impl_);
+
+    milvus::engine::meta::CollectionSchema collection;
+    collection.collection_id_ = collection_id;
+    auto status = cached->CreateCollection(collection);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::SegmentSchema table_file;
+    table_file.collection_id_ = collection_id;
+    status = cached->CreateCollectionFile(table_file);
+    ASSERT_TRUE(status.ok());
+    table_file.file_type_ = milvus::engine::meta::SegmentSchema::RAW;
+    table_file.row_count_ = 1;
+    status = cached->UpdateCollectionFile(table_file);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::FilesHolder files_holder;
+    status = cached->FilesToSearch(collection_id, files_holder);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files_holder.HoldFiles().size(), 1);
+
+    // a write that bypasses the cache is not seen
+    auto version = cached->Version();
+    milvus::engine::meta::SegmentSchema bypass_file;
+    bypass_file.collection_id_ = collection_id;
+    status = impl_->CreateCollectionFile(bypass_file);
+    ASSERT_TRUE(status.ok());
+    bypass_file.file_type_ = milvus::engine::meta::SegmentSchema::RAW;
+    bypass_file.row_count_ = 1;
+    status = impl_->UpdateCollectionFile(bypass_file);
+    ASSERT_TRUE(status.ok());
+
+    files_holder.ReleaseFiles();
+    status = cached->FilesToSearch(collection_id, files_holder);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files_holder.HoldFiles().size(), 1);
+    ASSERT_EQ(cached->Version(), version);
+
+    // a write through the cache drops the snapshot
+    table_file.file_type_ = milvus::engine::meta::SegmentSchema::TO_DELETE;
+    status = cached->UpdateCollectionFile(table_file);
+    ASSERT_TRUE(status.ok());
+    ASSERT_GT(cached->Version(), version);
+
+    files_holder.ReleaseFiles();
+    status = cached->FilesToSearch(collection_id, files_holder);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files_holder.HoldFiles().size(), 1);
+    ASSERT_EQ(files_holder.HoldFiles()[0].id_, bypass_file.id_);
+
+    std::set<std::string> partition_ids = {collection_id};
+    files_holder.ReleaseFiles();
+    status = cached->FilesToSearchEx(collection_id, partition_ids, files_holder);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files_holder.HoldFiles().size(), 1);
+
+    status = cached->DropCollections({collection_id});
+    ASSERT_TRUE(status.ok());
+    status = cached->DescribeCollection(collection);
+    ASSERT_FALSE(status.ok());
+}
@@ -18,6 +18,7 @@
 #include "db/IDGenerator.h"
 #include "db/IndexFailedChecker.h"
 #include "db/Options.h"
+#include "db/QueryResultCache.h"
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
 #include "db/meta/SqliteMetaImpl.h"
@@ -223,3 +224,31 @@ TEST(DBMiscTest, IDGENERATOR_TEST) {
 
     ASSERT_EQ(ids.size(), unique_ids.size());
 }
+
+TEST(DBMiscTest, QUERY_CACHE_KEY_TEST) {
+    milvus::engine::VectorsData vectors;
+    vectors.vector_count_ = 1;
+    vectors.float_data_ = {0.1f, 0.2f, 0.3f, 0.4f};
+
+    milvus::engine::meta::SegmentsSchema files(1);
+    files[0].file_id_ = "1";
+    files[0].row_count_ = 100;
+    milvus::json extra_params = {{"nprobe", 16}};
+
+    auto key = milvus::engine::QueryCacheKey("c", {"b", "a"}, 10, extra_params, vectors, files);
+    ASSERT_EQ(key, milvus::engine::QueryCacheKey("c", {"a", "b"}, 10, extra_params, vectors, files));
+    ASSERT_NE(key, milvus::engine::QueryCacheKey("c", {"a", "b"}, 20, extra_params, vectors, files));
+
+    // a delete or merge on the segment changes the key
+    files[0].updated_time_ = 1;
+    ASSERT_NE(key, milvus::engine::QueryCacheKey("c", {"a", "b"}, 10, extra_params, vectors, files));
+
+    milvus::engine::ResultIds ids = {1, 2};
+    milvus::engine::ResultDistances distances = {0.5f, 0.6f};
+    milvus::engine::QueryResultObj obj(vectors, ids, distances);
+    ASSERT_TRUE(obj.Match(vectors));
+    ASSERT_EQ(obj.Ids(), ids);
+
+    vectors.float_data_[0] = 1.0f;
+    ASSERT_FALSE(obj.Match(vectors));
+}
@@ -162,6 +162,52 @@ TEST(DBSearchTest, MERGE_RESULT_SET_TEST) {
     MergeTopkToResultSetTest(TOP_K / 2, TOP_K / 3, NQ, TOP_K, false);
 }
 
+TEST(DBSearchTest, MERGE_RESULT_SET_IN_PLACE_TEST) {
+    size_t NQ = 15;
+    size_t TOP_K = 64;
+    size_t SEGMENT_COUNT = 8;
+
+    for (bool ascending : {true, false}) {
+        ms::ResultIds result_ids;
+        ms::ResultDistances result_distances;
+        std::vector<ms::ResultDistances> segment_distances(SEGMENT_COUNT);
+        const int64_t* result_data = nullptr;
+        for (size_t s = 0; s < SEGMENT_COUNT; s++) {
+            ms::ResultIds ids;
+            size_t input_k = (s % 2 == 0) ? TOP_K : TOP_K / 2;
+            BuildResult(ids, segment_distances[s], input_k, TOP_K, NQ, ascending);
+            ms::XSearchTask::MergeTopkToResultSet(ids, segment_distances[s], input_k, NQ, TOP_K, ascending,
+                                                  result_ids, result_distances);
+            ASSERT_EQ(result_ids.size(), NQ * TOP_K);
+
+            // once the result set is full, the following segments are merged without reallocation
+            if (result_data != nullptr) {
+                ASSERT_EQ(result_ids.data(), result_data);
+            }
+            result_data = result_ids.data();
+        }
+
+        for (size_t i = 0; i < NQ; i++) {
+            std::vector<float> expect;
+            for (auto& distances : segment_distances) {
+                for (size_t j = 0; j < TOP_K; j++) {
+                    if (distances[i * TOP_K + j] >= 0.0) {
+                        expect.push_back(distances[i * TOP_K + j]);
+                    }
+                }
+            }
+            if (ascending) {
+                std::sort(expect.begin(), expect.end());
+            } else {
+                std::sort(expect.begin(), expect.end(), std::greater<float>());
+            }
+            for (size_t j = 0; j < TOP_K; j++) {
+                ASSERT_EQ(result_distances[i * TOP_K + j], expect[j]);
+            }
+        }
+    }
+}
+
 //void MergeTopkArrayTest(size_t topk_1, size_t topk_2, size_t nq, size_t topk, bool ascending) {
 //    std::vector<int64_t> ids1, ids2;
 //    std::vector<float> dist1, dist2;
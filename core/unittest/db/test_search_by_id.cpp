@@ -419,6 +419,47 @@ TEST_F(GetVectorByIdTest, WITH_INDEX_TEST) {
     ASSERT_LT(result_distances[0], 1e-3);
 }
 
+TEST_F(GetVectorByIdTest, MULTI_SEGMENT_TEST) {
+    milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_info);
+    ASSERT_TRUE(stat.ok());
+
+    // more segments than one batch of parallel bloom filter probes
+    const int64_t segment_count = 20, nb = 100;
+    std::vector<milvus::engine::VectorsData> xbs(segment_count);
+    for (int64_t k = 0; k < segment_count; ++k) {
+        BuildVectors(nb, xbs[k]);
+        for (int64_t i = 0; i < nb; i++) {
+            xbs[k].id_array_.push_back(k * nb + i);
+        }
+        milvus::engine::VectorsData xb = xbs[k];
+        stat = db_->InsertVectors(collection_info.collection_id_, "", xb);
+        ASSERT_TRUE(stat.ok());
+        stat = db_->Flush();
+        ASSERT_TRUE(stat.ok());
+    }
+
+    std::vector<int64_t> ids_to_search = {segment_count * nb - 1, 0, segment_count * nb, nb + 1};
+    std::vector<milvus::engine::VectorsData> vectors;
+    stat = db_->GetVectorsByID(collection_info, "", ids_to_search, vectors);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(vectors.size(), ids_to_search.size());
+    ASSERT_EQ(vectors[2].vector_count_, 0);
+
+    for (size_t i = 0; i < ids_to_search.size(); ++i) {
+        if (i == 2) {
+            continue;
+        }
+        auto& xb = xbs[ids_to_search[i] / nb];
+        auto offset = ids_to_search[i] % nb;
+        ASSERT_EQ(vectors[i].vector_count_, 1);
+        ASSERT_EQ(vectors[i].float_data_.size(), COLLECTION_DIM);
+        for (int64_t j = 0; j < COLLECTION_DIM; ++j) {
+            ASSERT_EQ(vectors[i].float_data_[j], xb.float_data_[offset * COLLECTION_DIM + j]);
+        }
+    }
+}
+
 TEST_F(GetVectorByIdTest, WITH_DELETE_TEST) {
     milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
     auto stat = db_->CreateCollection(collection_info);
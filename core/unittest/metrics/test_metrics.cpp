@@ -166,4 +166,46 @@ TEST_F(MetricTest, COLLECTOR_METRICS_TEST) {
     milvus::server::MetricCollector metric_collector();
 }
 
+TEST_F(MetricTest, COLLECTION_ACCOUNTING_TEST) {
+    auto& accounting = milvus::server::CollectionAccounting::GetInstance();
+    accounting.AddSearch("accounting_a", 100);
+    accounting.AddSearch("accounting_a", 300);
+    accounting.AddSearchTask("accounting_a", 1000, 50);
+    accounting.AddSearchStages("accounting_a", "IVF_FLAT", {{"search", 20}, {"reduce", 5}});
+    accounting.AddInsert("accounting_a", 10, 1024);
+    accounting.AddSearchTask("accounting_b", 2000, 500);
+    {
+        milvus::server::CollectCollectionTaskMetrics flush_metrics("accounting_b",
+                                                                   milvus::server::CollectionTaskType::FLUSH);
+    }
+    accounting.SetCacheBytes({{"accounting_a", 4096}});
+
+    auto top = accounting.TopN(2);
+    ASSERT_EQ(top.size(), 2);
+    ASSERT_EQ(top[0].first, "accounting_b");
+    ASSERT_EQ(top[1].first, "accounting_a");
+
+    auto& usage = top[1].second;
+    ASSERT_EQ(usage.search_count_, 2);
+    ASSERT_DOUBLE_EQ(usage.search_us_, 400);
+    ASSERT_EQ(usage.rows_scanned_, 1000);
+    ASSERT_EQ(usage.insert_rows_, 10);
+    ASSERT_EQ(usage.insert_bytes_, 1024);
+    ASSERT_EQ(usage.cache_bytes_, 4096);
+    ASSERT_EQ(top[0].second.cache_bytes_, 0);
+    ASSERT_GE(top[0].second.flush_us_, 0);
+
+    ASSERT_EQ(accounting.TopN(1).size(), 1);
+    auto json = accounting.Dump(1);
+    ASSERT_EQ(json["collections"].size(), 1);
+    accounting.Export();
+
+    accounting.Remove("accounting_a");
+    accounting.Remove("accounting_b");
+    for (auto& pair : accounting.TopN(100)) {
+        ASSERT_NE(pair.first, "accounting_a");
+        ASSERT_NE(pair.first, "accounting_b");
+    }
+}
+
 
@@ -14,10 +14,13 @@
 #include <ostream>
 
 #include "scheduler/Algorithm.h"
+#include "scheduler/JobMgr.h"
 #include "scheduler/ResourceFactory.h"
 #include "scheduler/ResourceMgr.h"
 #include "scheduler/resource/CpuResource.h"
 #include "scheduler/resource/Resource.h"
+#include "scheduler/task/BuildIndexTask.h"
+#include "scheduler/tasklabel/SpecResLabel.h"
 
 namespace milvus {
 namespace scheduler {
@@ -184,5 +187,25 @@ TEST_F(AlgorithmTest, SHORTESTPATH_TEST) {
     std::cout << std::endl;
 }
 
+TEST_F(AlgorithmTest, CALCULATE_PATH_CACHE_TEST) {
+    auto expect = std::make_shared<XBuildIndexTask>(nullptr, std::make_shared<SpecResLabel>(gpu_1_));
+    JobMgr::calculate_path(res_mgr_, expect);
+
+    std::unordered_map<std::string, std::vector<std::string>> path_cache;
+    for (size_t i = 0; i < 3; ++i) {
+        auto task = std::make_shared<XBuildIndexTask>(nullptr, std::make_shared<SpecResLabel>(gpu_1_));
+        JobMgr::calculate_path(res_mgr_, task, path_cache);
+        ASSERT_EQ(task->path().Dump(), expect->path().Dump());
+        ASSERT_EQ(task->path().Current(), "disk");
+        ASSERT_EQ(task->path().Last(), "gpu1");
+    }
+    ASSERT_EQ(path_cache.size(), 1);
+
+    auto task = std::make_shared<XBuildIndexTask>(nullptr, std::make_shared<SpecResLabel>(cpu_0_));
+    JobMgr::calculate_path(res_mgr_, task, path_cache);
+    ASSERT_EQ(task->path().Last(), "cpu0");
+    ASSERT_EQ(path_cache.size(), 2);
+}
+
 }  // namespace scheduler
 }  // namespace milvus
@@ -12,6 +12,8 @@
 #include <gtest/gtest.h>
 
 #include "scheduler/TaskTable.h"
+#include "scheduler/task/BuildIndexTask.h"
+#include "scheduler/task/SearchTask.h"
 #include "scheduler/task/TestTask.h"
 
 /************ TaskTableBaseTest ************/
@@ -255,6 +257,43 @@ TEST_F(TaskTableBaseTest, PICK_TO_LOAD_CACHE) {
     ASSERT_EQ(indexes[0] % empty_table_.capacity(), 2);
 }
 
+TEST_F(TaskTableBaseTest, PICK_TO_LOAD_LOOKAHEAD) {
+    const size_t NUM_TASKS = milvus::scheduler::LOAD_LOOKAHEAD_MAX + 2;
+    for (size_t i = 0; i < NUM_TASKS; ++i) {
+        empty_table_.Put(task1_);
+    }
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::LOADED;
+
+    // a loaded task no longer blocks loading the next ones
+    auto indexes = empty_table_.PickToLoad(1);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 1);
+
+    for (size_t i = 0; i < milvus::scheduler::LOAD_LOOKAHEAD_MAX; ++i) {
+        empty_table_[i]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    }
+    indexes = empty_table_.PickToLoad(1);
+    ASSERT_TRUE(indexes.empty());
+}
+
+TEST_F(TaskTableBaseTest, PICK_TO_LOAD_CACHE_FIRST) {
+    auto file = std::make_shared<milvus::scheduler::SegmentSchema>();
+    file->engine_type_ = (int)milvus::engine::EngineType::FAISS_IDMAP;
+    file->dimension_ = 64;
+    file->location_ = "/tmp/milvus_test/cold_segment";
+    file->file_size_ = 1024;
+    empty_table_.Put(std::make_shared<milvus::scheduler::XSearchTask>(nullptr, file, nullptr));
+    empty_table_.Put(task1_);
+
+    // the cached task is loaded before the cold one queued ahead of it
+    auto indexes = empty_table_.PickToLoad(2);
+    ASSERT_EQ(indexes.size(), 2);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 1);
+    ASSERT_EQ(indexes[1] % empty_table_.capacity(), 0);
+    ASSERT_EQ(empty_table_[0]->load_cost, 1024);
+    ASSERT_EQ(empty_table_[1]->load_cost, 0);
+}
+
 TEST_F(TaskTableBaseTest, PICK_TO_EXECUTE) {
     const size_t NUM_TASKS = 10;
     for (size_t i = 0; i < NUM_TASKS; ++i) {
@@ -307,6 +346,91 @@ TEST_F(TaskTableBaseTest, PICK_TO_EXECUTE_CACHE) {
     ASSERT_EQ(indexes[0] % empty_table_.capacity(), 2);
 }
 
+TEST_F(TaskTableBaseTest, PICK_PRIORITY) {
+    const size_t NUM_BUILDS = 4;
+    for (size_t i = 0; i < NUM_BUILDS; ++i) {
+        empty_table_.Put(std::make_shared<milvus::scheduler::XBuildIndexTask>(nullptr, nullptr));
+    }
+    empty_table_.Put(task1_);
+    ASSERT_EQ(empty_table_[0]->priority, milvus::scheduler::TaskPriority::BUILD_INDEX);
+    ASSERT_EQ(empty_table_[NUM_BUILDS]->priority, milvus::scheduler::TaskPriority::INTERACTIVE_SEARCH);
+
+    // the search enqueued behind the builds goes first
+    auto indexes = empty_table_.PickToLoad(2);
+    ASSERT_EQ(indexes.size(), 2);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), NUM_BUILDS);
+    ASSERT_EQ(indexes[1] % empty_table_.capacity(), 0);
+
+    for (size_t i = 0; i <= NUM_BUILDS; ++i) {
+        empty_table_[i]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    }
+    indexes = empty_table_.PickToExecute(NUM_BUILDS + 1);
+    ASSERT_EQ(indexes.size(), NUM_BUILDS + 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), NUM_BUILDS);
+    for (size_t i = 0; i < NUM_BUILDS; ++i) {
+        ASSERT_EQ(indexes[i + 1] % empty_table_.capacity(), i);
+    }
+}
+
+TEST_F(TaskTableBaseTest, PICK_STARVATION) {
+    empty_table_.Put(std::make_shared<milvus::scheduler::XBuildIndexTask>(nullptr, nullptr));
+    empty_table_.Put(task1_);
+    empty_table_.Put(task2_);
+    empty_table_[0]->timestamp.start -=
+        milvus::scheduler::TASK_STARVATION_MS[static_cast<size_t>(milvus::scheduler::TaskPriority::BUILD_INDEX)];
+
+    // the long waiting build overtakes the searches
+    auto indexes = empty_table_.PickToLoad(1);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 0);
+}
+
+TEST_F(TaskTableBaseTest, PICK_STALE_BUILD) {
+    empty_table_.Put(std::make_shared<milvus::scheduler::XBuildIndexTask>(nullptr, nullptr));
+    empty_table_.Put(task1_);
+    empty_table_.Put(task2_);
+    // older than the starvation limit of searches, but builds wait much longer
+    auto search_lane = static_cast<size_t>(milvus::scheduler::TaskPriority::INTERACTIVE_SEARCH);
+    empty_table_[0]->timestamp.start -= milvus::scheduler::TASK_STARVATION_MS[search_lane] + 1000;
+
+    // the fresh searches still go first
+    for (uint64_t expected : {1, 2, 0}) {
+        auto indexes = empty_table_.PickToLoad(10);
+        ASSERT_FALSE(indexes.empty());
+        ASSERT_EQ(indexes[0] % empty_table_.capacity(), expected);
+        ASSERT_TRUE(empty_table_.Load(indexes[0]));
+    }
+}
+
+TEST_F(TaskTableBaseTest, PICK_CHARGE_TAKEN_ONLY) {
+    const size_t NUM_BUILDS = 2;
+    const size_t NUM_SEARCHES = 4;
+    for (size_t i = 0; i < NUM_BUILDS; ++i) {
+        empty_table_.Put(std::make_shared<milvus::scheduler::XBuildIndexTask>(nullptr, nullptr));
+    }
+    for (size_t i = 0; i < NUM_SEARCHES; ++i) {
+        empty_table_.Put(task1_);
+    }
+
+    // picking without taking charges nothing, the order stays the same
+    auto first = empty_table_.PickToLoad(10);
+    ASSERT_EQ(first.size(), NUM_BUILDS + NUM_SEARCHES);
+    for (size_t i = 0; i < 10; ++i) {
+        ASSERT_EQ(empty_table_.PickToLoad(10), first);
+    }
+
+    // each taken item is one round of the 8:2 weights, the builds are interleaved with the searches
+    std::vector<uint64_t> taken;
+    for (size_t i = 0; i < NUM_BUILDS + NUM_SEARCHES; ++i) {
+        auto indexes = empty_table_.PickToLoad(10);
+        ASSERT_FALSE(indexes.empty());
+        ASSERT_TRUE(empty_table_.Load(indexes[0]));
+        taken.push_back(indexes[0] % empty_table_.capacity());
+    }
+    std::vector<uint64_t> expected = {2, 3, 0, 4, 5, 1};
+    ASSERT_EQ(taken, expected);
+}
+
 /************ TaskTableAdvanceTest ************/
 
 class TaskTableAdvanceTest : public ::testing::Test {
@@ -446,3 +570,25 @@ TEST_F(TaskTableAdvanceTest, MOVED) {
         }
     }
 }
+
+TEST_F(TaskTableAdvanceTest, STATE_COUNT) {
+    auto count = table1_.StateCount();
+    ASSERT_EQ(count.size(), 8);
+    for (auto& pair : count) {
+        ASSERT_EQ(pair.second, 1);
+    }
+
+    table1_.Load(1);
+    count = table1_.StateCount();
+    ASSERT_EQ(count["START"], 0);
+    ASSERT_EQ(count["LOADING"], 2);
+}
+
+TEST_F(TaskTableAdvanceTest, DUMP) {
+    auto dump = table1_.Dump();
+    ASSERT_EQ(dump["size"].get<int64_t>(), 8);
+    // executed and moved tasks are finished
+    ASSERT_EQ(dump["queue_depth"].get<int64_t>(), 6);
+    ASSERT_EQ(dump["tasks"].size(), 6);
+    ASSERT_EQ(dump["states"]["EXECUTED"].get<int64_t>(), 1);
+}
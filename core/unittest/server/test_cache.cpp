@@ -235,6 +235,45 @@ TEST(CacheTest, INVALID_TEST) {
     }
 }
 
+TEST(CacheTest, STATS_TEST) {
+    LessItemCacheMgr mgr;
+    auto make_item = []() {
+        // each item is 1k byte
+        milvus::knowhere::VecIndexPtr mock_index = std::make_shared<MockVecIndex>(256, 1);
+        return std::static_pointer_cast<milvus::cache::DataObj>(mock_index);
+    };
+
+    mgr.InsertItem("index_0", make_item());
+    mgr.InsertItem("index_1", make_item());
+    ASSERT_TRUE(mgr.GetItem("index_0") != nullptr);
+    ASSERT_TRUE(mgr.GetItem("index_0") != nullptr);
+    ASSERT_TRUE(mgr.GetItem("index_x") == nullptr);
+    ASSERT_EQ(mgr.HitCount(), 2);
+    ASSERT_EQ(mgr.MissCount(), 1);
+    ASSERT_EQ(mgr.EvictionCount(), 0);
+
+    auto dump = mgr.Dump(1);
+    ASSERT_EQ(dump["item_count"].get<int64_t>(), 2);
+    ASSERT_EQ(dump["items"].size(), 1);
+    ASSERT_EQ(dump["items"][0]["key"].get<std::string>(), "index_0");
+    ASSERT_EQ(dump["items"][0]["hits"].get<int64_t>(), 2);
+    ASSERT_EQ(dump["items"][0]["size"].get<int64_t>(), 1024);
+    ASSERT_GT(dump["items"][0]["last_access"].get<int64_t>(), 0);
+
+    // capacity is 4k byte, further inserts evict the least recently used items
+    for (int i = 2; i < 8; ++i) {
+        mgr.InsertItem("index_" + std::to_string(i), make_item());
+    }
+    ASSERT_GT(mgr.EvictionCount(), 0);
+    ASSERT_FALSE(mgr.ItemExists("index_1"));
+
+    InvalidCacheMgr invalid_mgr;
+    ASSERT_EQ(invalid_mgr.HitCount(), 0);
+    ASSERT_EQ(invalid_mgr.MissCount(), 0);
+    ASSERT_EQ(invalid_mgr.EvictionCount(), 0);
+    ASSERT_TRUE(invalid_mgr.Dump(10).is_null());
+}
+
 TEST(CacheTest, PARTIAL_LRU_TEST) {
     constexpr int MAX_SIZE = 5;
     milvus::cache::LRU<int, int> lru(MAX_SIZE);
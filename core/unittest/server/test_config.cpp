@@ -269,6 +269,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetMetricConfigPort(str_val).ok());
     ASSERT_TRUE(str_val == metric_port);
 
+    int64_t metric_collection_top_n = 10;
+    ASSERT_TRUE(config.SetMetricConfigCollectionTopN(std::to_string(metric_collection_top_n)).ok());
+    ASSERT_TRUE(config.GetMetricConfigCollectionTopN(int64_val).ok());
+    ASSERT_TRUE(int64_val == metric_collection_top_n);
+
     /* cache config */
     int64_t cache_cpu_cache_capacity = 1;
     ASSERT_TRUE(config.SetCacheConfigCpuCacheCapacity(std::to_string(cache_cpu_cache_capacity)).ok());
@@ -290,6 +295,10 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetCacheConfigCacheInsertData(bool_val).ok());
     ASSERT_TRUE(bool_val == cache_insert_data);
 
+    ASSERT_TRUE(config.SetCacheConfigQueryCacheSize("64MB").ok());
+    ASSERT_TRUE(config.GetCacheConfigQueryCacheSize(int64_val).ok());
+    ASSERT_TRUE(int64_val == 64 * 1024 * 1024);
+
     {
         // #2564
         int64_t total_mem = 0, free_mem = 0;
@@ -348,6 +357,56 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetEngineConfigMaxPartitionNum(int64_val).ok());
     ASSERT_TRUE(int64_val == max_partition);
 
+    int64_t dql_executor_num = 8;
+    ASSERT_TRUE(config.SetEngineConfigDqlExecutorNum(std::to_string(dql_executor_num)).ok());
+    ASSERT_TRUE(config.GetEngineConfigDqlExecutorNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == dql_executor_num);
+
+    int64_t dql_large_executor_num = 2;
+    ASSERT_TRUE(config.SetEngineConfigDqlLargeExecutorNum(std::to_string(dql_large_executor_num)).ok());
+    ASSERT_TRUE(config.GetEngineConfigDqlLargeExecutorNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == dql_large_executor_num);
+
+    int64_t dql_large_query_threshold = 5000;
+    ASSERT_TRUE(config.SetEngineConfigDqlLargeQueryThreshold(std::to_string(dql_large_query_threshold)).ok());
+    ASSERT_TRUE(config.GetEngineConfigDqlLargeQueryThreshold(int64_val).ok());
+    ASSERT_TRUE(int64_val == dql_large_query_threshold);
+
+    int64_t dql_memory_limit = 1073741824;
+    ASSERT_TRUE(config.SetEngineConfigDqlMemoryLimit(std::to_string(dql_memory_limit)).ok());
+    ASSERT_TRUE(config.GetEngineConfigDqlMemoryLimit(int64_val).ok());
+    ASSERT_TRUE(int64_val == dql_memory_limit);
+
+    bool engine_meta_cache_enable = false;
+    ASSERT_TRUE(config.SetEngineConfigMetaCacheEnable(std::to_string(engine_meta_cache_enable)).ok());
+    ASSERT_TRUE(config.GetEngineConfigMetaCacheEnable(bool_val).ok());
+    ASSERT_TRUE(bool_val == engine_meta_cache_enable);
+
+    float engine_search_profile_sample_rate = 0.5;
+    ASSERT_TRUE(config.SetEngineConfigSearchProfileSampleRate(std::to_string(engine_search_profile_sample_rate)).ok());
+    ASSERT_TRUE(config.GetEngineConfigSearchProfileSampleRate(float_val).ok());
+    ASSERT_TRUE(float_val == engine_search_profile_sample_rate);
+
+    int64_t engine_slow_query_threshold = 100;
+    ASSERT_TRUE(config.SetEngineConfigSlowQueryThreshold(std::to_string(engine_slow_query_threshold)).ok());
+    ASSERT_TRUE(config.GetEngineConfigSlowQueryThreshold(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_slow_query_threshold);
+
+    float engine_recall_sample_ratio = 0.1;
+    ASSERT_TRUE(config.SetEngineConfigRecallSampleRatio(std::to_string(engine_recall_sample_ratio)).ok());
+    ASSERT_TRUE(config.GetEngineConfigRecallSampleRatio(float_val).ok());
+    ASSERT_TRUE(float_val == engine_recall_sample_ratio);
+
+    float engine_auto_tune_target_recall = 0.95;
+    ASSERT_TRUE(config.SetEngineConfigAutoTuneTargetRecall(std::to_string(engine_auto_tune_target_recall)).ok());
+    ASSERT_TRUE(config.GetEngineConfigAutoTuneTargetRecall(float_val).ok());
+    ASSERT_TRUE(float_val == engine_auto_tune_target_recall);
+
+    int64_t engine_auto_tune_latency_slo_ms = 50;
+    ASSERT_TRUE(config.SetEngineConfigAutoTuneLatencySloMs(std::to_string(engine_auto_tune_latency_slo_ms)).ok());
+    ASSERT_TRUE(config.GetEngineConfigAutoTuneLatencySloMs(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_auto_tune_latency_slo_ms);
+
 #ifdef MILVUS_GPU_VERSION
     int64_t engine_gpu_search_threshold = 800;
     auto status = config.SetGpuResourceConfigGpuSearchThreshold(std::to_string(engine_gpu_search_threshold));
@@ -396,6 +455,17 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     }
 #endif
 
+    /* tracing config */
+    float tracing_sample_rate = 0.01;
+    ASSERT_TRUE(config.SetTracingConfigSampleRate(std::to_string(tracing_sample_rate)).ok());
+    ASSERT_TRUE(config.GetTracingConfigSampleRate(float_val).ok());
+    ASSERT_TRUE(float_val == tracing_sample_rate);
+
+    std::string tracing_exporter_path = "stdout";
+    ASSERT_TRUE(config.SetTracingConfigExporterPath(tracing_exporter_path).ok());
+    ASSERT_TRUE(config.GetTracingConfigExporterPath(str_val).ok());
+    ASSERT_TRUE(str_val == tracing_exporter_path);
+
     /* wal config */
     bool wal_enable = false;
     ASSERT_TRUE(config.SetWalConfigEnable(std::to_string(wal_enable)).ok());
@@ -736,6 +806,9 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetMetricConfigPort("0xff").ok());
 
+    ASSERT_FALSE(config.SetMetricConfigCollectionTopN("0").ok());
+    ASSERT_FALSE(config.SetMetricConfigCollectionTopN("-1").ok());
+
     /* cache config */
     ASSERT_FALSE(config.SetCacheConfigCpuCacheCapacity("a").ok());
     ASSERT_FALSE(config.SetCacheConfigCpuCacheCapacity("0").ok());
@@ -753,6 +826,9 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetCacheConfigCacheInsertData("N").ok());
 
+    ASSERT_FALSE(config.SetCacheConfigQueryCacheSize("-1").ok());
+    ASSERT_FALSE(config.SetCacheConfigQueryCacheSize("2048GB").ok());
+
     /* engine config */
     ASSERT_FALSE(config.SetEngineConfigUseBlasThreshold("0xff").ok());
 
@@ -762,6 +838,18 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetEngineConfigSimdType("None").ok());
 
+    ASSERT_FALSE(config.SetEngineConfigDqlExecutorNum("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigDqlExecutorNum("0").ok());
+    ASSERT_FALSE(config.SetEngineConfigDqlLargeExecutorNum("-1").ok());
+    ASSERT_FALSE(config.SetEngineConfigDqlLargeQueryThreshold("1e5").ok());
+    ASSERT_FALSE(config.SetEngineConfigDqlMemoryLimit("1GB").ok());
+    ASSERT_FALSE(config.SetEngineConfigMetaCacheEnable("maybe").ok());
+    ASSERT_FALSE(config.SetEngineConfigSearchProfileSampleRate("1.5").ok());
+    ASSERT_FALSE(config.SetEngineConfigSlowQueryThreshold("-1").ok());
+    ASSERT_FALSE(config.SetEngineConfigRecallSampleRatio("1.5").ok());
+    ASSERT_FALSE(config.SetEngineConfigAutoTuneTargetRecall("1.5").ok());
+    ASSERT_FALSE(config.SetEngineConfigAutoTuneLatencySloMs("-1").ok());
+
 #ifdef MILVUS_GPU_VERSION
     ASSERT_FALSE(config.SetGpuResourceConfigGpuSearchThreshold("-1").ok());
 #endif
@@ -786,6 +874,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(config.SetGpuResourceConfigBuildIndexResources("gpu0, gpu0, gpu1").ok());
 #endif
 
+    /* tracing config */
+    ASSERT_FALSE(config.SetTracingConfigSampleRate("a").ok());
+    ASSERT_FALSE(config.SetTracingConfigSampleRate("1.5").ok());
+    ASSERT_FALSE(config.SetTracingConfigSampleRate("-0.1").ok());
+
     /* wal config */
     ASSERT_FALSE(config.SetWalConfigWalPath("hello/world").ok());
     ASSERT_FALSE(config.SetWalConfigWalPath("").ok());
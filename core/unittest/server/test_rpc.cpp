@@ -13,6 +13,11 @@
 #include <opentracing/mocktracer/tracer.h>
 
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <future>
+#include <regex>
 #include <thread>
 
 #include "config/Config.h"
@@ -20,8 +25,13 @@
 #include "server/delivery/RequestHandler.h"
 #include "server/delivery/RequestScheduler.h"
 #include "server/delivery/request/BaseRequest.h"
+#include "server/delivery/request/SearchCombineRequest.h"
+#include "server/delivery/request/SearchRequest.h"
+#include "server/delivery/strategy/SearchReqStrategy.h"
 #include "server/grpc_impl/GrpcRequestHandler.h"
 #include "src/version.h"
+#include "tracing/SpanExporter.h"
+#include "tracing/TracerUtil.h"
 
 #include "grpc/gen-milvus/milvus.grpc.pb.h"
 #include "grpc/gen-status/status.pb.h"
@@ -30,9 +40,12 @@
 #include "server/DBWrapper.h"
 #include "server/grpc_impl/GrpcServer.h"
 #include "utils/CommonUtil.h"
+#include "utils/StringHelpFunctions.h"
 
 #include <fiu-control.h>
 #include <fiu-local.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
 
 namespace {
 
@@ -189,6 +202,28 @@ CurrentTmDate(int64_t offset_day = 0) {
     return str;
 }
 
+milvus::server::SearchRequestPtr
+CreateSearchRequest(const std::string& collection_name, int64_t nq, int64_t topk,
+                    milvus::server::TopKQueryResult& result) {
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(0, nq, record_array);
+    milvus::engine::VectorsData vectors;
+    vectors.vector_count_ = nq;
+    for (auto& record : record_array) {
+        vectors.float_data_.insert(vectors.float_data_.end(), record.begin(), record.end());
+    }
+
+    auto context = std::make_shared<milvus::server::Context>("search_request_id");
+    opentracing::mocktracer::MockTracerOptions tracer_options;
+    auto mock_tracer =
+        std::shared_ptr<opentracing::Tracer>{new opentracing::mocktracer::MockTracer{std::move(tracer_options)}};
+    auto mock_span = mock_tracer->StartSpan("mock_span");
+    context->SetTraceContext(std::make_shared<milvus::tracing::TraceContext>(mock_span));
+    auto request = milvus::server::SearchRequest::Create(context, collection_name, vectors, topk,
+                                                         milvus::json::object(), {}, {}, result);
+    return std::static_pointer_cast<milvus::server::SearchRequest>(request);
+}
+
 }  // namespace
 
 TEST_F(RpcHandlerTest, HAS_COLLECTION_TEST) {
@@ -411,6 +446,26 @@ TEST_F(RpcHandlerTest, SEARCH_TEST) {
     handler->Search(&context, &request, &response);
     ASSERT_NE(response.ids_size(), 0UL);
 
+    // search asynchronously
+    ::milvus::grpc::TopKQueryResult async_response;
+    std::promise<void> async_done;
+    handler->SearchAsync(&context, &request, &async_response, [&async_done]() { async_done.set_value(); });
+    async_done.get_future().wait();
+    ASSERT_EQ(async_response.status().error_code(), ::milvus::grpc::SUCCESS);
+    ASSERT_EQ(async_response.ids_size(), response.ids_size());
+
+    // malformed extra params finish the call without searching
+    ::milvus::grpc::SearchParam invalid_request = request;
+    invalid_request.mutable_extra_params(0)->set_value("{ \"nprobe\": ");
+    ::milvus::grpc::TopKQueryResult invalid_response;
+    std::promise<void> invalid_done;
+    handler->SearchAsync(&context, &invalid_request, &invalid_response,
+                         [&invalid_done]() { invalid_done.set_value(); });
+    invalid_done.get_future().wait();
+    ASSERT_EQ(invalid_response.status().error_code(), ::milvus::grpc::ILLEGAL_ARGUMENT);
+    handler->Search(&context, &invalid_request, &invalid_response);
+    ASSERT_EQ(invalid_response.status().error_code(), ::milvus::grpc::ILLEGAL_ARGUMENT);
+
     // wrong file id
     ::milvus::grpc::SearchInFilesParam search_in_files_param;
     std::string* file_id = search_in_files_param.add_file_id_array();
@@ -419,6 +474,166 @@ TEST_F(RpcHandlerTest, SEARCH_TEST) {
     ASSERT_EQ(response.ids_size(), 0UL);
 }
 
+TEST_F(RpcHandlerTest, SEARCH_STREAM_TEST) {
+    ::grpc::ServerContext context;
+    handler->SetContext(&context, dummy_context);
+    handler->RegisterRequestHandler(milvus::server::RequestHandler());
+
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(0, VECTOR_COUNT, record_array);
+    ::milvus::grpc::InsertParam insert_param;
+    for (auto& record : record_array) {
+        ::milvus::grpc::RowRecord* grpc_record = insert_param.add_row_record_array();
+        CopyRowRecord(grpc_record, record);
+    }
+    insert_param.set_collection_name(COLLECTION_NAME);
+    ::milvus::grpc::VectorIds vector_ids;
+    handler->Insert(&context, &insert_param, &vector_ids);
+
+    ::milvus::grpc::Status grpc_status;
+    ::milvus::grpc::FlushParam flush_param;
+    flush_param.add_collection_name_array(COLLECTION_NAME);
+    handler->Flush(&context, &flush_param, &grpc_status);
+
+    // large enough for the streamed result to be split into several messages
+    const int64_t nq = 200, topk = 1024;
+    ::milvus::grpc::SearchParam request;
+    request.set_collection_name(COLLECTION_NAME);
+    request.set_topk(topk);
+    milvus::grpc::KeyValuePair* kv = request.add_extra_params();
+    kv->set_key(milvus::server::grpc::EXTRA_PARAM_KEY);
+    kv->set_value("{ \"nprobe\": 32 }");
+    BuildVectors(0, nq, record_array);
+    for (auto& record : record_array) {
+        ::milvus::grpc::RowRecord* row_record = request.add_query_record_array();
+        CopyRowRecord(row_record, record);
+    }
+
+    using GrpcServer = milvus::server::grpc::GrpcServer;
+    GrpcServer& server = GrpcServer::GetInstance();
+    server.Start();
+    sleep(2);
+
+    auto channel = ::grpc::CreateChannel("127.0.0.1:19531", ::grpc::InsecureChannelCredentials());
+    auto stub = ::milvus::grpc::MilvusService::NewStub(channel);
+
+    ::grpc::ClientContext search_context;
+    ::milvus::grpc::TopKQueryResult response;
+    ASSERT_TRUE(stub->Search(&search_context, request, &response).ok());
+    ASSERT_EQ(response.status().error_code(), ::milvus::grpc::SUCCESS);
+    ASSERT_EQ(response.row_num(), nq);
+
+    // the concatenated messages carry exactly the result of the unary search
+    ::grpc::ClientContext stream_context;
+    auto reader = stub->SearchStream(&stream_context, request);
+    ::milvus::grpc::TopKQueryResult chunk;
+    std::vector<int64_t> ids;
+    std::vector<float> distances;
+    int64_t row_num = 0, chunk_count = 0;
+    while (reader->Read(&chunk)) {
+        ASSERT_EQ(chunk.status().error_code(), ::milvus::grpc::SUCCESS);
+        ASSERT_EQ(chunk.ids_size(), chunk.row_num() * topk);
+        ASSERT_EQ(chunk.distances_size(), chunk.ids_size());
+        ids.insert(ids.end(), chunk.ids().begin(), chunk.ids().end());
+        distances.insert(distances.end(), chunk.distances().begin(), chunk.distances().end());
+        row_num += chunk.row_num();
+        chunk_count++;
+    }
+    ASSERT_TRUE(reader->Finish().ok());
+    ASSERT_GT(chunk_count, 1);
+    ASSERT_EQ(row_num, response.row_num());
+    ASSERT_EQ(ids, std::vector<int64_t>(response.ids().begin(), response.ids().end()));
+    ASSERT_EQ(distances, std::vector<float>(response.distances().begin(), response.distances().end()));
+
+    // a failed search is reported by a single message
+    request.set_collection_name("not_exist_collection");
+    ::grpc::ClientContext error_context;
+    reader = stub->SearchStream(&error_context, request);
+    chunk_count = 0;
+    while (reader->Read(&chunk)) {
+        ASSERT_NE(chunk.status().error_code(), ::milvus::grpc::SUCCESS);
+        ASSERT_EQ(chunk.row_num(), 0);
+        chunk_count++;
+    }
+    ASSERT_TRUE(reader->Finish().ok());
+    ASSERT_EQ(chunk_count, 1);
+
+    server.Stop();
+}
+
+TEST_F(RpcHandlerTest, SEARCH_MULTI_TEST) {
+    ::grpc::ServerContext context;
+    handler->SetContext(&context, dummy_context);
+    handler->RegisterRequestHandler(milvus::server::RequestHandler());
+
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(0, VECTOR_COUNT, record_array);
+    ::milvus::grpc::InsertParam insert_param;
+    for (auto& record : record_array) {
+        ::milvus::grpc::RowRecord* grpc_record = insert_param.add_row_record_array();
+        CopyRowRecord(grpc_record, record);
+    }
+    insert_param.set_collection_name(COLLECTION_NAME);
+    ::milvus::grpc::VectorIds vector_ids;
+    handler->Insert(&context, &insert_param, &vector_ids);
+
+    ::milvus::grpc::Status grpc_status;
+    ::milvus::grpc::FlushParam flush_param;
+    flush_param.add_collection_name_array(COLLECTION_NAME);
+    handler->Flush(&context, &flush_param, &grpc_status);
+
+    ::milvus::grpc::SearchParam request;
+    request.set_collection_name(COLLECTION_NAME);
+    request.set_topk(10);
+    milvus::grpc::KeyValuePair* kv = request.add_extra_params();
+    kv->set_key(milvus::server::grpc::EXTRA_PARAM_KEY);
+    kv->set_value("{ \"nprobe\": 32 }");
+    BuildVectors(0, 10, record_array);
+    for (auto& record : record_array) {
+        ::milvus::grpc::RowRecord* row_record = request.add_query_record_array();
+        CopyRowRecord(row_record, record);
+    }
+    ::milvus::grpc::SearchParam error_request = request;
+    error_request.set_collection_name("not_exist_collection");
+
+    using GrpcServer = milvus::server::grpc::GrpcServer;
+    GrpcServer& server = GrpcServer::GetInstance();
+    server.Start();
+    sleep(2);
+
+    auto channel = ::grpc::CreateChannel("127.0.0.1:19531", ::grpc::InsecureChannelCredentials());
+    auto stub = ::milvus::grpc::MilvusService::NewStub(channel);
+
+    ::grpc::ClientContext search_context;
+    ::milvus::grpc::TopKQueryResult response;
+    ASSERT_TRUE(stub->Search(&search_context, request, &response).ok());
+    ASSERT_EQ(response.status().error_code(), ::milvus::grpc::SUCCESS);
+
+    // results come back in the order of searches, the missing collection only fails its own search
+    ::grpc::ClientContext multi_context;
+    auto stream = stub->SearchMulti(&multi_context);
+    ASSERT_TRUE(stream->Write(error_request));
+    ASSERT_TRUE(stream->Write(request));
+    ASSERT_TRUE(stream->WritesDone());
+    std::vector<::milvus::grpc::TopKQueryResult> results;
+    ::milvus::grpc::TopKQueryResult result;
+    while (stream->Read(&result)) {
+        results.push_back(result);
+    }
+    ASSERT_TRUE(stream->Finish().ok());
+    ASSERT_EQ(results.size(), 2UL);
+    ASSERT_NE(results[0].status().error_code(), ::milvus::grpc::SUCCESS);
+    ASSERT_EQ(results[0].ids_size(), 0);
+    ASSERT_EQ(results[1].status().error_code(), ::milvus::grpc::SUCCESS);
+    ASSERT_EQ(results[1].row_num(), response.row_num());
+    ASSERT_EQ(std::vector<int64_t>(results[1].ids().begin(), results[1].ids().end()),
+              std::vector<int64_t>(response.ids().begin(), response.ids().end()));
+    ASSERT_EQ(std::vector<float>(results[1].distances().begin(), results[1].distances().end()),
+              std::vector<float>(response.distances().begin(), response.distances().end()));
+
+    server.Stop();
+}
+
 TEST_F(RpcHandlerTest, COMBINE_SEARCH_TEST) {
     ::grpc::ServerContext context;
     handler->SetContext(&context, dummy_context);
@@ -520,6 +735,165 @@ TEST_F(RpcHandlerTest, COMBINE_SEARCH_TEST) {
     }
 }
 
+TEST_F(RpcHandlerTest, COMBINE_SEARCH_TOPK_TEST) {
+    ::grpc::ServerContext context;
+    handler->SetContext(&context, dummy_context);
+    handler->RegisterRequestHandler(milvus::server::RequestHandler());
+
+    // create collection
+    std::string collection_name = "search_combines_topk";
+    ::milvus::grpc::CollectionSchema collection_schema;
+    collection_schema.set_collection_name(collection_name);
+    collection_schema.set_dimension(COLLECTION_DIM);
+    collection_schema.set_index_file_size(INDEX_FILE_SIZE);
+    collection_schema.set_metric_type(1);  // L2 metric
+    ::milvus::grpc::Status status;
+    handler->CreateCollection(&context, &collection_schema, &status);
+    ASSERT_EQ(status.error_code(), 0) << status.reason();
+
+    // insert vectors
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(0, VECTOR_COUNT, record_array);
+    ::milvus::grpc::InsertParam insert_param;
+    int64_t vec_id = 0;
+    for (auto& record : record_array) {
+        ::milvus::grpc::RowRecord* grpc_record = insert_param.add_row_record_array();
+        CopyRowRecord(grpc_record, record);
+        insert_param.add_row_id_array(++vec_id);
+    }
+
+    insert_param.set_collection_name(collection_name);
+    ::milvus::grpc::VectorIds vector_ids;
+    handler->Insert(&context, &insert_param, &vector_ids);
+
+    // flush
+    ::milvus::grpc::Status grpc_status;
+    ::milvus::grpc::FlushParam flush_param;
+    flush_param.add_collection_name_array(collection_name);
+    handler->Flush(&context, &flush_param, &grpc_status);
+
+    // combine requests with different topk, each one gets its own topk of the max topk search
+    int64_t NQ = 3;
+    int64_t SMALL_TOPK = 5;
+    int64_t LARGE_TOPK = 20;
+    milvus::server::TopKQueryResult small_result, large_result;
+    auto small_request = CreateSearchRequest(collection_name, NQ, SMALL_TOPK, small_result);
+    auto large_request = CreateSearchRequest(collection_name, NQ, LARGE_TOPK, large_result);
+    ASSERT_TRUE(milvus::server::SearchCombineRequest::CanCombine(small_request, large_request));
+
+    milvus::server::SearchCombineRequest combine_request;
+    ASSERT_TRUE(combine_request.Combine(small_request).ok());
+    ASSERT_TRUE(combine_request.Combine(large_request).ok());
+    ASSERT_TRUE(combine_request.Execute().ok());
+    ASSERT_TRUE(small_request->status().ok());
+    ASSERT_TRUE(large_request->status().ok());
+
+    ASSERT_EQ(small_result.row_num_, NQ);
+    ASSERT_EQ(large_result.row_num_, NQ);
+    ASSERT_EQ(small_result.id_list_.size(), static_cast<size_t>(NQ * SMALL_TOPK));
+    ASSERT_EQ(small_result.distance_list_.size(), static_cast<size_t>(NQ * SMALL_TOPK));
+    ASSERT_EQ(large_result.id_list_.size(), static_cast<size_t>(NQ * LARGE_TOPK));
+    ASSERT_EQ(large_result.distance_list_.size(), static_cast<size_t>(NQ * LARGE_TOPK));
+
+    // both requests search the same vectors, the small topk result is the head of the large topk result
+    for (int64_t i = 0; i < NQ; i++) {
+        for (int64_t k = 0; k < SMALL_TOPK; k++) {
+            ASSERT_EQ(small_result.id_list_[i * SMALL_TOPK + k], large_result.id_list_[i * LARGE_TOPK + k]);
+            ASSERT_FLOAT_EQ(small_result.distance_list_[i * SMALL_TOPK + k],
+                            large_result.distance_list_[i * LARGE_TOPK + k]);
+        }
+        ASSERT_LT(small_result.distance_list_[i * SMALL_TOPK], 0.00001);
+    }
+
+    // the stages of the combined search are charged to each request
+    auto small_timer = small_request->Context()->GetStageTimer();
+    auto large_timer = large_request->Context()->GetStageTimer();
+    ASSERT_NE(small_timer, nullptr);
+    ASSERT_NE(large_timer, nullptr);
+    ASSERT_GT(small_timer->Get(milvus::server::SearchStage::SEARCH), 0);
+    ASSERT_EQ(small_timer->Get(milvus::server::SearchStage::SEARCH),
+              large_timer->Get(milvus::server::SearchStage::SEARCH));
+    ASSERT_FALSE(small_timer->Tasks().empty());
+    ASSERT_EQ(small_timer->Tasks().size(), large_timer->Tasks().size());
+}
+
+TEST_F(RpcHandlerTest, SLOW_QUERY_LOG_TEST) {
+    ::grpc::ServerContext context;
+    handler->SetContext(&context, dummy_context);
+    handler->RegisterRequestHandler(milvus::server::RequestHandler());
+
+    // create collection
+    std::string collection_name = "slow_query_log";
+    ::milvus::grpc::CollectionSchema collection_schema;
+    collection_schema.set_collection_name(collection_name);
+    collection_schema.set_dimension(COLLECTION_DIM);
+    collection_schema.set_index_file_size(INDEX_FILE_SIZE);
+    collection_schema.set_metric_type(1);  // L2 metric
+    ::milvus::grpc::Status status;
+    handler->CreateCollection(&context, &collection_schema, &status);
+    ASSERT_EQ(status.error_code(), 0) << status.reason();
+
+    // insert vectors
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(0, VECTOR_COUNT, record_array);
+    ::milvus::grpc::InsertParam insert_param;
+    for (auto& record : record_array) {
+        ::milvus::grpc::RowRecord* grpc_record = insert_param.add_row_record_array();
+        CopyRowRecord(grpc_record, record);
+    }
+    insert_param.set_collection_name(collection_name);
+    ::milvus::grpc::VectorIds vector_ids;
+    handler->Insert(&context, &insert_param, &vector_ids);
+
+    ::milvus::grpc::FlushParam flush_param;
+    flush_param.add_collection_name_array(collection_name);
+    handler->Flush(&context, &flush_param, &status);
+
+    // a request queued 50ms ago exceeds the 1ms threshold
+    auto& config = milvus::server::Config::GetInstance();
+    ASSERT_TRUE(config.SetEngineConfigSlowQueryThreshold("1").ok());
+
+    int64_t NQ = 2;
+    int64_t TOPK = 10;
+    milvus::server::TopKQueryResult result;
+    auto request = CreateSearchRequest(collection_name, NQ, TOPK, result);
+    request->SetQueuedTime(std::chrono::system_clock::now() - std::chrono::milliseconds(50));
+    ASSERT_TRUE(request->Execute().ok());
+    ASSERT_TRUE(config.SetEngineConfigSlowQueryThreshold("0").ok());
+
+    ::milvus::grpc::Command command;
+    command.set_cmd("slow_log");
+    ::milvus::grpc::StringReply reply;
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    auto entries = milvus::json::parse(reply.string_reply());
+    ASSERT_TRUE(entries.is_array());
+    ASSERT_FALSE(entries.empty());
+    auto& entry = entries.back();
+    ASSERT_EQ(entry["request"], "search");
+    ASSERT_EQ(entry["request_id"], "search_request_id");
+    ASSERT_EQ(entry["status"], 0);
+    ASSERT_GE(entry["total_ms"].get<double>(), 50);
+    ASSERT_TRUE(std::regex_match(entry["time"].get<std::string>(),
+                                 std::regex(R"(\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{3}[+-]\d{4})")));
+
+    ASSERT_EQ(entry["params"]["collection_name"], collection_name);
+    ASSERT_EQ(entry["params"]["nq"], NQ);
+    ASSERT_EQ(entry["params"]["topk"], TOPK);
+    ASSERT_TRUE(entry["stages"].contains("search_ms"));
+    ASSERT_GT(entry["files_searched"].get<int64_t>(), 0);
+    ASSERT_EQ(entry["tasks"].size(), entry["files_searched"].get<size_t>());
+
+    // the threshold is disabled, later searches are not recorded
+    milvus::server::TopKQueryResult fast_result;
+    auto fast_request = CreateSearchRequest(collection_name, NQ, TOPK, fast_result);
+    fast_request->SetQueuedTime(std::chrono::system_clock::now() - std::chrono::milliseconds(50));
+    ASSERT_TRUE(fast_request->Execute().ok());
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(milvus::json::parse(reply.string_reply()).size(), entries.size());
+}
+
 TEST_F(RpcHandlerTest, COMBINE_SEARCH_BINARY_TEST) {
     ::grpc::ServerContext context;
     handler->SetContext(&context, dummy_context);
@@ -1187,6 +1561,81 @@ TEST_F(RpcHandlerTest, CMD_TEST) {
     handler->Cmd(&context, &command, &reply);
     ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
 
+    command.set_cmd("slow_log");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    command.set_cmd("scheduler");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    command.set_cmd("cache");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    command.set_cmd("wal");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    command.set_cmd("collections");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    command.set_cmd(std::string("auto_tune ") + COLLECTION_NAME);
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    command.set_cmd(std::string("auto_tune ") + COLLECTION_NAME + " 0.9 10");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    command.set_cmd(std::string("auto_tune ") + COLLECTION_NAME + " 1.5 10");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_NE(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    command.set_cmd("auto_tune");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_NE(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    command.set_cmd("profile heap");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    {
+        // keep a thread busy so the cpu timer fires while sampling
+        std::atomic<bool> stop{false};
+        std::thread busy_thread([&stop]() {
+            volatile uint64_t sum = 0;
+            while (!stop.load()) {
+                sum = sum + 1;
+            }
+        });
+        command.set_cmd("profile cpu 1");
+        handler->Cmd(&context, &command, &reply);
+        stop = true;
+        busy_thread.join();
+    }
+    ASSERT_EQ(reply.status().error_code(), ::grpc::Status::OK.error_code());
+    // folded stacks, one "frame;frame;... count" line per stack
+    std::vector<std::string> folded_lines;
+    milvus::server::StringHelpFunctions::SplitStringByDelimeter(reply.string_reply(), "\n", folded_lines);
+    folded_lines.erase(std::remove(folded_lines.begin(), folded_lines.end(), ""), folded_lines.end());
+    ASSERT_FALSE(folded_lines.empty());
+    bool has_nested_stack = false;
+    for (auto& line : folded_lines) {
+        ASSERT_TRUE(std::regex_match(line, std::regex(R"(\S.* [1-9]\d*)"))) << line;
+        has_nested_stack = has_nested_stack || line.find(';') != std::string::npos;
+    }
+    ASSERT_TRUE(has_nested_stack);
+
+    command.set_cmd("profile cpu 0");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_NE(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
+    command.set_cmd("profile bogus");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_NE(reply.status().error_code(), ::grpc::Status::OK.error_code());
+
     command.set_cmd("set_config");
     handler->Cmd(&context, &command, &reply);
 
@@ -1284,6 +1733,11 @@ TEST_F(RpcSchedulerTest, BASE_TASK_TEST) {
     milvus::server::RequestScheduler::GetInstance().ExecuteRequest(base_task_ptr5);
     fiu_disable("RequestScheduler.PutToQueue.push_null_thread");
 
+    milvus::server::BaseRequestPtr expired_task_ptr = DummyRequest::Create();
+    expired_task_ptr->Context()->SetDeadline(std::chrono::system_clock::now() - std::chrono::seconds(1));
+    status = milvus::server::RequestScheduler::GetInstance().ExecuteRequest(expired_task_ptr);
+    ASSERT_EQ(status.code(), milvus::SERVER_REQUEST_CANCELED);
+
     request_ptr = nullptr;
     milvus::server::RequestScheduler::GetInstance().ExecuteRequest(request_ptr);
 
@@ -1300,6 +1754,198 @@ TEST_F(RpcSchedulerTest, BASE_TASK_TEST) {
     milvus::server::RequestScheduler::GetInstance().Stop();
 }
 
+namespace {
+class CostRequest : public milvus::server::BaseRequest {
+ public:
+    CostRequest(const std::shared_ptr<milvus::server::Context>& context, int64_t cost, int64_t memory)
+        : BaseRequest(context, milvus::server::BaseRequest::kSearch), cost_(cost), memory_(memory) {
+    }
+
+    milvus::Status
+    OnExecute() override {
+        executed_ = true;
+        return milvus::Status::OK();
+    }
+
+    int64_t
+    EstimateCost() const override {
+        return cost_;
+    }
+
+    int64_t
+    EstimateMemory() const override {
+        return memory_;
+    }
+
+    bool executed_ = false;
+
+ private:
+    int64_t cost_;
+    int64_t memory_;
+};
+
+class TestRequestScheduler : public milvus::server::RequestScheduler {
+ public:
+    using RequestScheduler::AdmitRequest;
+    using RequestScheduler::ReleaseRequest;
+    using RequestScheduler::SelectRequestGroup;
+    using RequestScheduler::TakeToExecute;
+};
+}  // namespace
+
+TEST_F(RpcSchedulerTest, LANE_TEST) {
+    auto& config = milvus::server::Config::GetInstance();
+    ASSERT_TRUE(config.SetEngineConfigDqlLargeQueryThreshold("100").ok());
+
+    TestRequestScheduler scheduler;
+    auto context = std::make_shared<milvus::server::Context>("lane_request_id");
+    auto small = std::make_shared<CostRequest>(context, 10, 0);
+    auto large = std::make_shared<CostRequest>(context, 1000, 0);
+    ASSERT_EQ(scheduler.SelectRequestGroup(small), milvus::server::DQL_REQUEST_GROUP);
+    ASSERT_EQ(scheduler.SelectRequestGroup(large), milvus::server::DQL_LARGE_REQUEST_GROUP);
+    ASSERT_EQ(scheduler.SelectRequestGroup(request_ptr), milvus::server::INFO_REQUEST_GROUP);
+
+    // threshold 0 disables the large query lane
+    ASSERT_TRUE(config.SetEngineConfigDqlLargeQueryThreshold("0").ok());
+    ASSERT_EQ(scheduler.SelectRequestGroup(large), milvus::server::DQL_REQUEST_GROUP);
+
+    config.SetEngineConfigDqlLargeQueryThreshold(milvus::server::CONFIG_ENGINE_DQL_LARGE_QUERY_THRESHOLD_DEFAULT);
+}
+
+TEST_F(RpcSchedulerTest, ADMISSION_TEST) {
+    auto& config = milvus::server::Config::GetInstance();
+    ASSERT_TRUE(config.SetEngineConfigDqlMemoryLimit("100").ok());
+
+    const std::string& dql = milvus::server::DQL_REQUEST_GROUP;
+    const std::string& dql_large = milvus::server::DQL_LARGE_REQUEST_GROUP;
+    TestRequestScheduler scheduler;
+    // the first request is always admitted, even beyond the limit
+    scheduler.AdmitRequest(dql, 80);
+
+    std::atomic<bool> admitted(false);
+    std::thread waiter([&]() {
+        scheduler.AdmitRequest(dql, 50);
+        admitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_FALSE(admitted);
+
+    // releasing the first request lets the waiting one in
+    scheduler.ReleaseRequest(dql, 80);
+    waiter.join();
+    ASSERT_TRUE(admitted);
+    scheduler.ReleaseRequest(dql, 50);
+
+    // requests without memory estimation bypass admission control
+    scheduler.AdmitRequest(dql, 100);
+    scheduler.AdmitRequest(dql, 0);
+    scheduler.ReleaseRequest(dql, 100);
+
+    // large queries can't take the share reserved for the small ones
+    scheduler.AdmitRequest(dql_large, 50);
+    admitted = false;
+    std::thread large_waiter([&]() {
+        scheduler.AdmitRequest(dql_large, 30);
+        admitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_FALSE(admitted);
+
+    // small queries are still admitted up to the whole limit while the large one waits
+    scheduler.AdmitRequest(dql, 10);
+    scheduler.AdmitRequest(dql, 20);
+    ASSERT_FALSE(admitted);
+    scheduler.ReleaseRequest(dql, 20);
+    scheduler.ReleaseRequest(dql, 10);
+    scheduler.ReleaseRequest(dql_large, 50);
+    large_waiter.join();
+    ASSERT_TRUE(admitted);
+    scheduler.ReleaseRequest(dql_large, 30);
+
+    config.SetEngineConfigDqlMemoryLimit(milvus::server::CONFIG_ENGINE_DQL_MEMORY_LIMIT_DEFAULT);
+}
+
+TEST_F(RpcSchedulerTest, CANCELED_REQUEST_TEST) {
+    TestRequestScheduler scheduler;
+    auto canceled_context = std::make_shared<milvus::server::Context>("canceled_request_id");
+    canceled_context->SetDeadline(std::chrono::system_clock::now() - std::chrono::seconds(1));
+    auto canceled = std::make_shared<CostRequest>(canceled_context, 0, 0);
+    auto live = std::make_shared<CostRequest>(std::make_shared<milvus::server::Context>("live_request_id"), 0, 0);
+
+    auto queue = std::make_shared<milvus::server::RequestQueue>();
+    canceled->SetQueuedTime(std::chrono::system_clock::now());
+    live->SetQueuedTime(std::chrono::system_clock::now());
+    queue->PutRequest(canceled);
+    queue->PutRequest(live);
+    queue->Put(nullptr);
+
+    // the executor drops the canceled request at dequeue and runs the live one
+    scheduler.TakeToExecute(milvus::server::DQL_REQUEST_GROUP, queue);
+    ASSERT_FALSE(canceled->executed_);
+    ASSERT_EQ(canceled->status().code(), milvus::SERVER_REQUEST_CANCELED);
+    ASSERT_TRUE(live->executed_);
+    ASSERT_TRUE(live->status().ok());
+}
+
+TEST_F(RpcSchedulerTest, COMBINE_SCAN_WINDOW_TEST) {
+    milvus::server::SearchReqStrategy strategy;
+    std::deque<milvus::server::BaseRequestPtr> queue;
+    milvus::server::TopKQueryResult result;
+
+    // a search request followed by non-search requests and a search request of another collection
+    ASSERT_TRUE(strategy.ReScheduleQueue(CreateSearchRequest("a", 2, 10, result), queue).ok());
+    for (int64_t i = 0; i < 3; i++) {
+        queue.push_back(DummyRequest::Create());
+    }
+    ASSERT_TRUE(strategy.ReScheduleQueue(CreateSearchRequest("b", 2, 10, result), queue).ok());
+    ASSERT_EQ(queue.size(), 5UL);
+
+    // combined with the first request even though they are not adjacent
+    ASSERT_TRUE(strategy.ReScheduleQueue(CreateSearchRequest("a", 2, 10, result), queue).ok());
+    ASSERT_EQ(queue.size(), 5UL);
+    ASSERT_EQ(queue.front()->GetRequestType(), milvus::server::BaseRequest::kSearchCombine);
+    ASSERT_EQ(queue.back()->GetRequestType(), milvus::server::BaseRequest::kSearch);
+
+    // more requests join the combined one, topk could be different within the ratio
+    ASSERT_TRUE(strategy.ReScheduleQueue(CreateSearchRequest("a", 2, 100, result), queue).ok());
+    ASSERT_EQ(queue.size(), 5UL);
+
+    // topk ratio is too large, not combined
+    ASSERT_TRUE(strategy.ReScheduleQueue(CreateSearchRequest("a", 2, 1000, result), queue).ok());
+    ASSERT_EQ(queue.size(), 6UL);
+
+    // the combined request is out of the scan window, not combined
+    for (int64_t i = 0; i < 8; i++) {
+        queue.push_back(DummyRequest::Create());
+    }
+    ASSERT_TRUE(strategy.ReScheduleQueue(CreateSearchRequest("b", 2, 10, result), queue).ok());
+    ASSERT_EQ(queue.size(), 15UL);
+    ASSERT_EQ(queue.back()->GetRequestType(), milvus::server::BaseRequest::kSearch);
+}
+
+TEST_F(RpcSchedulerTest, COMBINE_TOPK_RATIO_TEST) {
+    milvus::server::TopKQueryResult result;
+    auto small = CreateSearchRequest("a", 2, 10, result);
+    auto large = CreateSearchRequest("a", 2, 100, result);
+    auto huge = CreateSearchRequest("a", 2, 1000, result);
+    ASSERT_TRUE(milvus::server::SearchCombineRequest::CanCombine(small, large));
+    ASSERT_TRUE(milvus::server::SearchCombineRequest::CanCombine(large, small));
+    ASSERT_FALSE(milvus::server::SearchCombineRequest::CanCombine(small, huge));
+    ASSERT_FALSE(milvus::server::SearchCombineRequest::CanCombine(huge, small));
+
+    // a gap far beyond 200 combines as long as the ratio is kept
+    ASSERT_TRUE(milvus::server::SearchCombineRequest::CanCombine(large, huge));
+
+    // the ratio is checked against both min topk and max topk of the combined requests
+    milvus::server::SearchCombineRequest combine_request;
+    ASSERT_TRUE(combine_request.Combine(large).ok());
+    ASSERT_TRUE(combine_request.CanCombine(CreateSearchRequest("a", 2, 1600, result)));
+    ASSERT_FALSE(combine_request.CanCombine(CreateSearchRequest("a", 2, 1601, result)));
+    ASSERT_TRUE(combine_request.Combine(small).ok());
+    ASSERT_FALSE(combine_request.CanCombine(CreateSearchRequest("a", 2, 250, result)));
+    ASSERT_TRUE(combine_request.CanCombine(CreateSearchRequest("a", 2, 160, result)));
+}
+
 TEST(RpcTest, RPC_SERVER_TEST) {
     using GrpcServer = milvus::server::grpc::GrpcServer;
     GrpcServer& server = GrpcServer::GetInstance();
@@ -1327,3 +1973,79 @@ TEST(RpcTest, InterceptorHookHandlerTest) {
     handler->OnPostRecvInitialMetaData(nullptr, nullptr);
     handler->OnPreSendMessage(nullptr, nullptr);
 }
+
+TEST(RpcTest, STAGE_TIMER_TEST) {
+    ASSERT_FALSE(milvus::server::StageTimer::Sample(0.0));
+    ASSERT_TRUE(milvus::server::StageTimer::Sample(1.0));
+
+    auto context = std::make_shared<milvus::server::Context>("stage_timer_request_id");
+    opentracing::mocktracer::MockTracerOptions tracer_options;
+    auto mock_tracer =
+        std::shared_ptr<opentracing::Tracer>{new opentracing::mocktracer::MockTracer{std::move(tracer_options)}};
+    auto mock_span = mock_tracer->StartSpan("mock_span");
+    context->SetTraceContext(std::make_shared<milvus::tracing::TraceContext>(mock_span));
+
+    // no timer, nothing recorded
+    {
+        milvus::server::ContextStage stage(context, milvus::server::SearchStage::META);
+    }
+
+    auto stage_timer = std::make_shared<milvus::server::StageTimer>(true);
+    context->SetStageTimer(stage_timer);
+    stage_timer->Add(milvus::server::SearchStage::QUEUE, 1500);
+    ASSERT_EQ(stage_timer->Get(milvus::server::SearchStage::QUEUE), 1500);
+
+    // child contexts report to the timer of their parent
+    auto child = context->Child("child");
+    ASSERT_EQ(child->GetStageTimer(), stage_timer);
+    {
+        milvus::server::ContextStage stage(child, milvus::server::SearchStage::SEARCH);
+        usleep(1000);
+    }
+    ASSERT_GE(stage_timer->Get(milvus::server::SearchStage::SEARCH), 1000);
+
+    stage_timer->SetLabels("stage_timer_collection", "IDMAP");
+    stage_timer->Observe();
+    ASSERT_TRUE(stage_timer->Sampled());
+    auto str = stage_timer->ToString();
+    ASSERT_NE(str.find("queue=1.500ms"), std::string::npos);
+    ASSERT_NE(str.find("serialize="), std::string::npos);
+}
+
+TEST(RpcTest, TRACING_TEST) {
+    milvus::tracing::TracerUtil::SetSampleRate(0.0);
+    ASSERT_FALSE(milvus::tracing::TracerUtil::Sample());
+    milvus::tracing::TracerUtil::SetSampleRate(1.0);
+    ASSERT_TRUE(milvus::tracing::TracerUtil::Sample());
+    ASSERT_NE(milvus::tracing::TracerUtil::NoopTracer(), nullptr);
+
+    std::string export_path = "/tmp/milvus_test/spans.json";
+    boost::filesystem::create_directories("/tmp/milvus_test");
+    boost::filesystem::remove(export_path);
+    auto exporter = std::make_unique<milvus::tracing::SpanExporter>();
+    ASSERT_FALSE(exporter->Open("/tmp/milvus_test/not_exist/spans.json"));
+    ASSERT_TRUE(exporter->Open(export_path));
+
+    opentracing::mocktracer::MockTracerOptions tracer_options;
+    tracer_options.recorder = std::move(exporter);
+    auto mock_tracer =
+        std::shared_ptr<opentracing::Tracer>{new opentracing::mocktracer::MockTracer{std::move(tracer_options)}};
+    auto mock_span = mock_tracer->StartSpan("tracing_test");
+    auto context = std::make_shared<milvus::server::Context>("tracing_request_id");
+    context->SetTraceContext(std::make_shared<milvus::tracing::TraceContext>(mock_span));
+
+    context->RecordSpan("Request queue wait", std::chrono::system_clock::now() - std::chrono::milliseconds(10));
+    {
+        milvus::server::ContextChild tracer(context, "XSearchTask::Load");
+        tracer.SetTag("segment_id", std::string("tracing_segment"));
+        tracer.SetTag("cache_hit", true);
+    }
+    context->GetTraceContext()->GetSpan()->Finish();
+    mock_tracer->Close();
+
+    std::ifstream file(export_path);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_NE(content.find("Request queue wait"), std::string::npos);
+    ASSERT_NE(content.find("tracing_segment"), std::string::npos);
+    ASSERT_NE(content.find("cache_hit"), std::string::npos);
+}
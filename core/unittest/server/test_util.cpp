@@ -216,6 +216,32 @@ TEST(UtilTest, STRINGFUNCTIONS_TEST) {
     ASSERT_FALSE(milvus::server::StringHelpFunctions::IsRegexMatch("abc", "a\\dc"));
 }
 
+TEST(UtilTest, BASE64_TEST) {
+    ASSERT_EQ(milvus::server::StringHelpFunctions::EncodeBase64("Man", 3), "TWFu");
+    ASSERT_EQ(milvus::server::StringHelpFunctions::EncodeBase64("Ma", 2), "TWE=");
+    ASSERT_EQ(milvus::server::StringHelpFunctions::EncodeBase64("M", 1), "TQ==");
+    ASSERT_EQ(milvus::server::StringHelpFunctions::EncodeBase64("", 0), "");
+
+    std::vector<float> vector = {0.5f, -1.25f, 3.0f};
+    auto encoded = milvus::server::StringHelpFunctions::EncodeBase64(vector.data(), vector.size() * sizeof(float));
+
+    std::string bytes;
+    auto status = milvus::server::StringHelpFunctions::DecodeBase64(encoded, bytes);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(bytes.size(), vector.size() * sizeof(float));
+    ASSERT_EQ(memcmp(bytes.data(), vector.data(), bytes.size()), 0);
+
+    // padding is optional
+    status = milvus::server::StringHelpFunctions::DecodeBase64("TWE", bytes);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(bytes, "Ma");
+
+    status = milvus::server::StringHelpFunctions::DecodeBase64("!!not base64!!", bytes);
+    ASSERT_EQ(status.code(), milvus::SERVER_INVALID_ARGUMENT);
+    status = milvus::server::StringHelpFunctions::DecodeBase64("TWFuT", bytes);
+    ASSERT_EQ(status.code(), milvus::SERVER_INVALID_ARGUMENT);
+}
+
 TEST(UtilTest, BLOCKINGQUEUE_TEST) {
     milvus::server::BlockingQueue<std::string> bq;
 
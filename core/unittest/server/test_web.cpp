@@ -11,6 +11,7 @@
 
 #include <unistd.h>
 
+#include <cstring>
 #include <random>
 #include <thread>
 
@@ -1027,6 +1028,75 @@ TEST_F(WebControllerTest, SEARCH) {
     ASSERT_EQ(milvus::server::web::StatusCode::COLLECTION_NOT_EXISTS, error_dto->code->getValue());
 }
 
+TEST_F(WebControllerTest, SEARCH_BASE64) {
+    const OString collection_name = "test_search_base64_test" + OString(RandomName().c_str());
+    GenCollection(client_ptr, conncetion_ptr, collection_name, 64, 100, "L2");
+
+    auto status = InsertData(client_ptr, conncetion_ptr, collection_name, 64, 200);
+    ASSERT_TRUE(status.ok()) << status.message();
+
+    const int64_t nq = 5;
+    const int64_t topk = 10;
+    auto vectors_json = RandomRecordsJson(64, nq);
+
+    // search with float arrays
+    nlohmann::json search_json;
+    search_json["search"]["topk"] = topk;
+    search_json["search"]["params"]["nprobe"] = 1;
+    search_json["search"]["vectors"] = vectors_json;
+    auto response = client_ptr->vectorsOp(collection_name, search_json.dump().c_str(), conncetion_ptr);
+    ASSERT_EQ(OStatus::CODE_200.code, response->getStatusCode());
+    auto array_result_json = nlohmann::json::parse(response->readBodyToString()->std_str());
+    ASSERT_EQ(nq, array_result_json["num"].get<int64_t>());
+
+    // search with the same vectors as base64 strings of float32 bytes, and ask for base64 result
+    nlohmann::json base64_vectors_json;
+    for (auto& vector_json : vectors_json) {
+        std::vector<float> vector = vector_json.get<std::vector<float>>();
+        base64_vectors_json.push_back(
+            milvus::server::StringHelpFunctions::EncodeBase64(vector.data(), vector.size() * sizeof(float)));
+    }
+    search_json["search"]["vectors"] = base64_vectors_json;
+    search_json["search"]["result_encoding"] = "base64";
+    response = client_ptr->vectorsOp(collection_name, search_json.dump().c_str(), conncetion_ptr);
+    ASSERT_EQ(OStatus::CODE_200.code, response->getStatusCode());
+    auto base64_result_json = nlohmann::json::parse(response->readBodyToString()->std_str());
+    ASSERT_EQ(nq, base64_result_json["num"].get<int64_t>());
+    ASSERT_EQ(topk, base64_result_json["topk"].get<int64_t>());
+
+    std::string id_bytes, distance_bytes;
+    status =
+        milvus::server::StringHelpFunctions::DecodeBase64(base64_result_json["ids"].get<std::string>(), id_bytes);
+    ASSERT_TRUE(status.ok()) << status.message();
+    status = milvus::server::StringHelpFunctions::DecodeBase64(base64_result_json["distances"].get<std::string>(),
+                                                               distance_bytes);
+    ASSERT_TRUE(status.ok()) << status.message();
+    ASSERT_EQ(id_bytes.size(), nq * topk * sizeof(int64_t));
+    ASSERT_EQ(distance_bytes.size(), nq * topk * sizeof(float));
+
+    std::vector<int64_t> ids(nq * topk);
+    std::vector<float> distances(nq * topk);
+    memcpy(ids.data(), id_bytes.data(), id_bytes.size());
+    memcpy(distances.data(), distance_bytes.data(), distance_bytes.size());
+
+    // both forms return the same hits
+    for (int64_t i = 0; i < nq; i++) {
+        auto& row_json = array_result_json["result"][i];
+        ASSERT_EQ(static_cast<size_t>(topk), row_json.size());
+        for (int64_t k = 0; k < topk; k++) {
+            auto& hit_json = row_json[k];
+            ASSERT_EQ(std::stoll(hit_json["id"].get<std::string>()), ids[i * topk + k]);
+            ASSERT_NEAR(std::stof(hit_json["distance"].get<std::string>()), distances[i * topk + k], 1e-5);
+        }
+    }
+
+    // a base64 vector must hold whole float32 values
+    search_json["search"]["vectors"] = {milvus::server::StringHelpFunctions::EncodeBase64("abc", 3)};
+    response = client_ptr->vectorsOp(collection_name, search_json.dump().c_str(), conncetion_ptr);
+    auto error_dto = response->readBodyToDto<milvus::server::web::StatusDto>(object_mapper.get());
+    ASSERT_EQ(milvus::server::web::StatusCode::ILLEGAL_BODY, error_dto->code->getValue());
+}
+
 TEST_F(WebControllerTest, SEARCH_BIN) {
     const OString collection_name = "test_search_bin_collection_test" + OString(RandomName().c_str());
     GenCollection(client_ptr, conncetion_ptr, collection_name, 64, 100, "HAMMING");
@@ -1230,6 +1300,12 @@ TEST_F(WebControllerTest, CMD) {
 
     response = client_ptr->cmd("info", "", "", conncetion_ptr);
     ASSERT_EQ(OStatus::CODE_200.code, response->getStatusCode());
+
+    response = client_ptr->cmd("scheduler", "", "", conncetion_ptr);
+    ASSERT_EQ(OStatus::CODE_200.code, response->getStatusCode());
+
+    response = client_ptr->cmd("cache", "", "", conncetion_ptr);
+    ASSERT_EQ(OStatus::CODE_200.code, response->getStatusCode());
 }
 
 TEST_F(WebControllerTest, CONFIG) {